@@ -71,7 +71,7 @@ public:
     int myTeam;             // 자신의 팀 (0: RED, 1: BLUE)
     bool isMyLeader;        // 자신이 리더인지 여부
     
-    int sessionId;          // 게임 세션 ID
+    long long sessionId;    // 게임 세션 ID (서버가 보내는 게임 시작 시각 ms)
     std::vector<Player> players;
     std::vector<GameCard> cards;
 
@@ -9,11 +9,18 @@
 #include <functional>
 #include <thread>
 #include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <vector>
 
 class IOCPClient {
 public:
     static constexpr int BUFFER_SIZE = 2048;
     static constexpr int SERVER_PORT = 55014;
+    static constexpr size_t MAX_FRAME_BODY = 16 * 1024; // 바이너리 프레임 본문 최대 길이 (넘으면 잘못된 서버로 보고 연결 종료)
+    // 하트비트(PING) 주기 - 서버의 가장 짧은 무응답 제한(로그인 전 30초)보다 충분히 짧게
+    static constexpr std::chrono::seconds HEARTBEAT_INTERVAL{ 10 };
 
     IOCPClient();
     ~IOCPClient();
@@ -24,6 +31,8 @@ public:
     void Disconnect();
     bool SendData(const std::string& data);
     bool IsConnected() const { return connected_; }
+    // 접속 시 바이너리 프로토콜 협상 여부 (Connect 전에 설정, 기본 사용 - 구버전 서버면 자동으로 텍스트)
+    void SetBinaryProtocol(bool enabled) { useBinary_ = enabled; }
 
     std::function<void(const std::string&)> onDataReceived;  // 데이터 수신 콜백
     std::function<void()> onConnected;
@@ -33,12 +42,32 @@ private:
     bool InitializeIOCP();
     void CleanupIOCP();
     void WorkerThread();
-    void ProcessReceivedData(const std::string& data);
+    bool ProcessReceivedData(const std::string& data); // 잘못된 프레임이면 false (연결 종료)
+    bool PostFrame(const std::string& data);            // sendMutex_ 보유 상태에서 호출
+    bool HandleFormatReply(const std::string& packet);  // 협상 응답이면 처리하고 true (앱으로 넘기지 않음)
+    void StartHeartbeat();
+    void StopHeartbeat();
+    void HeartbeatThread();
 
     SOCKET socket_;
     HANDLE iocpHandle_;
     std::atomic<bool> connected_;
     std::unique_ptr<std::thread> workerThread_;
+    std::string recvBuffer_;  // 프레임 재조립 버퍼 (워커 스레드 전용)
+
+    // wire format 협상 (PacketProtocol.h의 PROTO)
+    std::mutex sendMutex_;                 // 아래 송신 상태 보호 (SendData는 UI 스레드, 협상 응답은 워커 스레드)
+    bool useBinary_;
+    bool negotiating_;                     // PROTO 응답 대기 중 - 그동안 SendData는 pendingSends_에 보관
+    bool binarySend_;
+    std::vector<std::string> pendingSends_;
+    bool binaryRecv_;                      // 워커 스레드 전용
+
+    // 하트비트 - 로그인 화면이나 게임 중에 한동안 입력이 없어도 서버가 유휴 연결로 닫지 않도록
+    std::unique_ptr<std::thread> heartbeatThread_;
+    std::mutex heartbeatMutex_;
+    std::condition_variable heartbeatCv_;
+    bool heartbeatStop_;                   // heartbeatMutex_ 보호
 
     struct IOContext {
         OVERLAPPED overlapped;
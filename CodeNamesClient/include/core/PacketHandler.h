@@ -1,59 +1,54 @@
 #pragma once
 
 #include <string>
-#include <functional>
-#include <unordered_map>
 #include <memory>
 
+#include "PacketOpcode.h"
+#include "PacketFields.h"
+
 class GameState;
 
 class PacketHandler {
 public:
-    using PacketCallback = std::function<void(const std::string&)>;
-
     explicit PacketHandler(std::shared_ptr<GameState> gameState);
 
-    // 패킷 타입별 핸들러 등록
-    void RegisterHandler(const std::string& packetType, PacketCallback callback);
-
-    // 수신한 패킷 처리
+    // 수신한 패킷 처리 (opcode로 핸들러 표에서 바로 찾음 - PacketOpcode.h)
     void ProcessPacket(const std::string& packet);
 
-    // 기본 핸들러들 등록 (자동 호출)
-    void RegisterDefaultHandlers();
-
 private:
+    // 패킷 핸들러 (fields는 패킷 이름 뒤를 한 번에 나눈 필드들 - PacketFields.h)
+    using Handler = void (PacketHandler::*)(const Packet::Fields& fields);
+
     std::shared_ptr<GameState> gameState_;
-    std::unordered_map<std::string, PacketCallback> handlers_;
 
     // ==================== 기본 패킷 핸들러들 ====================
     // 인증
-    void HandleSignupOk(const std::string& data);
-    void HandleLoginOk(const std::string& data);
-    void HandleInvalidToken(const std::string& data);
+    void HandleSignupOk(const Packet::Fields& fields);
+    void HandleLoginOk(const Packet::Fields& fields);
+    void HandleInvalidToken(const Packet::Fields& fields);
 
     // 사용자 정보
-    void HandleUserProfile(const std::string& data);
+    void HandleUserProfile(const Packet::Fields& fields);
 
     // 게임 프로토콜
-    void HandleWaitReply(const std::string& data);
-    void HandleQueueFull(const std::string& data);
-    void HandleGameInit(const std::string& data);
-    void HandleGameStart(const std::string& data);
-    void HandleAllCards(const std::string& data);
-    void HandleRoleInfo(const std::string& data);
-    void HandleTurnUpdate(const std::string& data);
-    void HandleHintMsg(const std::string& data);
-    void HandleCardUpdate(const std::string& data);
-    void HandleChatMsg(const std::string& data);
-    void HandleGameOver(const std::string& data);
+    void HandleWaitReply(const Packet::Fields& fields);
+    void HandleQueueFull(const Packet::Fields& fields);
+    void HandleGameInit(const Packet::Fields& fields);
+    void HandleGameStart(const Packet::Fields& fields);
+    void HandleAllCards(const Packet::Fields& fields);
+    void HandleRoleInfo(const Packet::Fields& fields);
+    void HandleTurnUpdate(const Packet::Fields& fields);
+    void HandleHintMsg(const Packet::Fields& fields);
+    void HandleCardUpdate(const Packet::Fields& fields);
+    void HandleChatMsg(const Packet::Fields& fields);
+    void HandleGameOver(const Packet::Fields& fields);
 
     // 기타
-    void HandleError(const std::string& data);
+    void HandleError(const Packet::Fields& fields);
     // 로그인 실패용 사용자 피드백 (계정 없음 / 비밀번호 틀림 등)
     void HandleLoginFailure(const std::string& reason);
-
-    // ==================== 유틸리티 함수 ====================
-    // 패킷 데이터 파싱
-    std::string ParseField(const std::string& data, int fieldIndex, const std::string& delimiter = "|");
+    void HandleLoginNoAccount(const Packet::Fields& fields);
+    void HandleLoginWrongPassword(const Packet::Fields& fields);
+    void HandleLoginSuspended(const Packet::Fields& fields);
+    void HandleLoginError(const Packet::Fields& fields);
 };
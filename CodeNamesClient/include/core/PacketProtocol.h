@@ -1,5 +1,17 @@
 #pragma once
 
+// --- Framing ---
+// 모든 메시지는 구분자로 끝난다 (TCP 스트림에서 메시지 경계 복원용)
+#define PKT_DELIMITER              '\n'                    // MESSAGE|field|...\n
+
+// --- Wire format 협상 (BinaryCodec.h) ---
+// 접속 직후 텍스트로 PROTO|BIN1을 보내고 응답을 받기 전까지는 다른 메시지를 보내지 않는다
+// PROTO_OK|BIN1 이후로는 양방향 모두 바이너리 프레임, 그 외 응답이면 텍스트 유지 (구버전 서버는 에러 응답)
+#define PKT_PROTO                  "PROTO"                  // client -> server: PROTO|format
+#define PKT_PROTO_OK               "PROTO_OK"               // server -> client: PROTO_OK|format (지원하지 않는 형식이면 TEXT)
+#define PKT_PROTO_BINARY           "BIN1"
+#define PKT_PROTO_TEXT             "TEXT"
+
 // --- Lobby / Matching / Session ---
 #define PKT_CMD_QUERY_WAIT          "CMD|QUERY_WAIT"         // client -> server: CMD|QUERY_WAIT|token
 #define PKT_WAIT_REPLY              "WAIT_REPLY"             // server -> client: WAIT_REPLY|playerCount|maxPlayers
@@ -10,6 +22,7 @@
 #define PKT_SESSION_NOT_FOUND      "SESSION_NOT_FOUND"      // server -> client: 세션 없음
 #define PKT_CANCEL_OK              "CANCEL_OK"              // server -> client: 매칭 취소 완료
 #define PKT_LOBBY_ERROR_UNKNOWN    "LOBBY_ERROR|UNKNOWN_PACKET" // server -> client: 알 수 없는 로비 패킷
+#define PKT_HEARTBEAT              "PING"                   // client -> server: 무응답 타임아웃 연장 (모든 상태, 응답 없음)
 
 // --- Auth ---
 #define PKT_CHECK_ID               "CHECK_ID"               // client -> server: CHECK_ID|id
@@ -37,6 +50,7 @@
 #define PKT_NICKNAME_EDIT_ERROR    "NICKNAME_EDIT_ERROR"    // server -> client
 
 #define PKT_AUTH_ERROR             "AUTH_ERROR"              // server -> client: AUTH_ERROR|reason (reason is sent after '|')
+#define PKT_AUTH_ERROR_UNKNOWN     "AUTH_ERROR|UNKNOWN_PACKET" // server -> client
 
 // --- Game (GameManager) ---
 #define PKT_GAME_INIT              "GAME_INIT"              // server -> client: GAME_INIT|nick1|role1|team1|leader1|...
@@ -56,6 +70,8 @@
 // --- Server control / errors ---
 #define PKT_GAME_CREATE_ERROR      "GAME_CREATE_ERROR"      // server -> client: 게임룸 생성 실패
 #define PKT_GAME_ERROR             "GAME_ERROR"             // generic game error (placeholder)
+#define PKT_SERVER_BUSY            "SERVER_BUSY"            // server -> client: 접속 직후 - 서버가 가득 차거나 과부하라 연결을 닫음 (잠시 후 재시도)
+#define PKT_RATE_LIMITED           "RATE_LIMITED"           // server -> client: RATE_LIMITED|AUTH|CHAT|ANSWER (너무 빠른 패킷은 버림, 연속 거절 중 1번만 알림)
 
 // --- Additional client->server commands (defined server-side for consistency) ---
 // these are commands that clients may send and server recognizes
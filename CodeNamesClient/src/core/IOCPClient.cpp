@@ -1,11 +1,16 @@
 #include <iostream>
+#include <cstring>
 #include "../../include/core/IOCPClient.h"
+#include "../../include/core/PacketProtocol.h"
+#include "../../include/core/BinaryCodec.h"
 
 IOCPClient::IOCPClient()
     : socket_(INVALID_SOCKET),        // 소켓 초기화
       iocpHandle_(NULL),              // IOCP 핸들 초기화
       connected_(false),              // 연결 상태 초기화
-      workerThread_(nullptr)          // 워커 스레드 초기화
+      workerThread_(nullptr),         // 워커 스레드 초기화
+      useBinary_(true), negotiating_(false), binarySend_(false), binaryRecv_(false),
+      heartbeatThread_(nullptr), heartbeatStop_(false)
 {
 }
 
@@ -80,6 +85,17 @@ bool IOCPClient::Connect(const std::string& ip, int port) {
     }
 
     connected_ = true;
+    recvBuffer_.clear();
+    binaryRecv_ = false;
+
+    // 바이너리 프로토콜 협상 - 응답 전까지 보내는 메시지는 모아 두었다가 정해진 형식으로 보냄
+    {
+        std::lock_guard<std::mutex> lock(sendMutex_);
+        binarySend_ = false;
+        pendingSends_.clear();
+        negotiating_ = useBinary_ && PostFrame(std::string(PKT_PROTO) + "|" + PKT_PROTO_BINARY);
+    }
+
     if (onConnected) {
         onConnected();
     }
@@ -99,13 +115,15 @@ bool IOCPClient::Connect(const std::string& ip, int port) {
         delete recvCtx;
         return false;
     }
-    
+
+    StartHeartbeat();
     return true;
 }
 
 void IOCPClient::Disconnect() {
     // connected false 설정
     connected_ = false;
+    StopHeartbeat();
     // socket이 유효하면 closesocket() 호출
     if (socket_ != INVALID_SOCKET) {
         closesocket(socket_);
@@ -123,25 +141,46 @@ bool IOCPClient::SendData(const std::string& data) {
         return false;
     }
     
-    // 버퍼 크기 검사
-    if (data.size() > BUFFER_SIZE) {
-        std::cerr << "Data too large: " << data.size() << " > " << BUFFER_SIZE << std::endl;
-        return false;
-    }
-    
     if (data.empty()) {
         std::cerr << "Empty data cannot be sent" << std::endl;
         return false;
     }
-    
+
+    std::lock_guard<std::mutex> lock(sendMutex_);
+    if (negotiating_) {
+        pendingSends_.push_back(data);
+        return true;
+    }
+    return PostFrame(data);
+}
+
+bool IOCPClient::PostFrame(const std::string& data) {
+    // 바이너리 연결이면 프레임으로 변환 (텍스트는 구분자만 붙임)
+    std::string encoded;
+    if (binarySend_) {
+        BinaryCodec::Encode(data, BinaryCodec::Direction::TO_SERVER, encoded);
+    }
+    size_t frameSize = binarySend_ ? encoded.size() : data.size() + 1;
+
+    // 버퍼 크기 검사 (구분자 / 프레임 헤더 포함)
+    if (frameSize > BUFFER_SIZE) {
+        std::cerr << "Data too large: " << frameSize << " > " << BUFFER_SIZE << std::endl;
+        return false;
+    }
+
     // 새로운 IOContext 동적 할당
     auto ctx = new IOContext();
     ZeroMemory(&ctx->overlapped, sizeof(OVERLAPPED));
     ctx->operation = 1;  // SEND
     ctx->wsaBuf.buf = ctx->buffer;
-    ctx->wsaBuf.len = static_cast<ULONG>(data.size());
-    memcpy(ctx->buffer, data.c_str(), data.size());
-    
+    ctx->wsaBuf.len = static_cast<ULONG>(frameSize);
+    if (binarySend_) {
+        memcpy(ctx->buffer, encoded.data(), encoded.size());
+    } else {
+        memcpy(ctx->buffer, data.c_str(), data.size());
+        ctx->buffer[data.size()] = PKT_DELIMITER;  // 메시지 끝 표시
+    }
+
     // WSASend 호출
     DWORD bytesSent = 0;
     int result = WSASend(
@@ -167,6 +206,40 @@ bool IOCPClient::SendData(const std::string& data) {
     return true;
 }
 
+void IOCPClient::StartHeartbeat() {
+    StopHeartbeat();
+    {
+        std::lock_guard<std::mutex> lock(heartbeatMutex_);
+        heartbeatStop_ = false;
+    }
+    heartbeatThread_ = std::make_unique<std::thread>(&IOCPClient::HeartbeatThread, this);
+}
+
+void IOCPClient::StopHeartbeat() {
+    {
+        std::lock_guard<std::mutex> lock(heartbeatMutex_);
+        heartbeatStop_ = true;
+    }
+    heartbeatCv_.notify_all();
+
+    if (heartbeatThread_ && heartbeatThread_->joinable()) {
+        heartbeatThread_->join();
+    }
+    heartbeatThread_.reset();
+}
+
+void IOCPClient::HeartbeatThread() {
+    // 서버는 PING에 응답하지 않고 마지막 수신 시각만 갱신함 (PacketProtocol.h)
+    std::unique_lock<std::mutex> lock(heartbeatMutex_);
+    while (!heartbeatCv_.wait_for(lock, HEARTBEAT_INTERVAL, [this] { return heartbeatStop_; })) {
+        lock.unlock();
+        if (connected_) {
+            SendData(PKT_HEARTBEAT);
+        }
+        lock.lock();
+    }
+}
+
 bool IOCPClient::InitializeIOCP() {
     // iocpHandle을 CreateIoCompletionPort()로 생성
     iocpHandle_ = CreateIoCompletionPort(
@@ -290,7 +363,12 @@ void IOCPClient::WorkerThread() {
             
             // 수신 데이터 처리
             std::string data(context->buffer, byteTransferred);
-            ProcessReceivedData(data);
+            if (!ProcessReceivedData(data)) {
+                std::cerr << "Malformed frame from server" << std::endl;
+                Disconnect();
+                delete context;
+                break;
+            }
             
             auto nextCtx = new IOContext();
             ZeroMemory(&nextCtx->overlapped, sizeof(OVERLAPPED));
@@ -322,10 +400,72 @@ void IOCPClient::WorkerThread() {
     }
 }
 
-void IOCPClient::ProcessReceivedData(const std::string& data) {
-    // onDataReceived 콜백 호출 (등록된 콜백이 있으면, data 전달)
+bool IOCPClient::ProcessReceivedData(const std::string& data) {
+    // 한 번의 수신에 여러 메시지가 붙어오거나 메시지가 잘려올 수 있으므로
+    // 프레임 단위로 잘라서 완성된 메시지만 onDataReceived 콜백으로 전달
+    // (바이너리 연결은 텍스트 메시지로 복원해서 전달 - PacketHandler는 형식을 모름)
+    recvBuffer_.append(data);
+
+    size_t start = 0;
+    std::string packet;
+    while (start < recvBuffer_.size()) {
+        if (binaryRecv_) {
+            const char* cursor = recvBuffer_.data() + start;
+            size_t length = recvBuffer_.size() - start;
+            std::string_view body;
+            BinaryCodec::FrameStatus status = BinaryCodec::ExtractFrame(cursor, length, MAX_FRAME_BODY, body);
+            if (status == BinaryCodec::FrameStatus::INCOMPLETE) break;
+            if (status == BinaryCodec::FrameStatus::MALFORMED ||
+                !BinaryCodec::Decode(body, BinaryCodec::Direction::TO_CLIENT, packet)) {
+                recvBuffer_.clear();
+                return false;
+            }
+            start = static_cast<size_t>(cursor - recvBuffer_.data());
+        } else {
+            size_t pos = recvBuffer_.find(PKT_DELIMITER, start);
+            if (pos == std::string::npos) break;
+
+            packet.assign(recvBuffer_, start, pos - start);
+            start = pos + 1;
+
+            if (!packet.empty() && packet.back() == '\r') {
+                packet.pop_back();
+            }
+            // 협상 응답 직후부터 바이너리일 수 있으므로 프레임마다 확인
+            if (HandleFormatReply(packet)) continue;
+        }
 
-    if (onDataReceived) {
-        onDataReceived(data);
+        if (!packet.empty() && onDataReceived) {
+            onDataReceived(packet);
+        }
     }
-}
\ No newline at end of file
+
+    // 남은 조각은 다음 수신과 이어붙임
+    recvBuffer_.erase(0, start);
+    return true;
+}
+
+bool IOCPClient::HandleFormatReply(const std::string& packet) {
+    std::lock_guard<std::mutex> lock(sendMutex_);
+    if (!negotiating_) return false;
+
+    bool binary;
+    if (packet == PKT_PROTO_OK "|" PKT_PROTO_BINARY) {
+        binary = true;
+    } else if (packet.compare(0, strlen(PKT_PROTO_OK), PKT_PROTO_OK) == 0 || packet == PKT_AUTH_ERROR_UNKNOWN) {
+        binary = false; // 서버가 거절했거나 PROTO를 모르는 구버전 서버
+    } else {
+        return false;   // SERVER_BUSY 등 응답 전에 온 메시지는 그대로 전달
+    }
+
+    negotiating_ = false;
+    binarySend_ = binary;
+    binaryRecv_ = binary;
+    std::cout << "Wire format: " << (binary ? "binary" : "text") << std::endl;
+
+    for (const std::string& pending : pendingSends_) {
+        PostFrame(pending);
+    }
+    pendingSends_.clear();
+    return true;
+}
@@ -9,55 +9,6 @@
 
 PacketHandler::PacketHandler(std::shared_ptr<GameState> gameState)
     : gameState_(gameState) {
-    // 기본 핸들러들 등록
-    RegisterDefaultHandlers();
-}
-
-void PacketHandler::RegisterHandler(const std::string& packetType, PacketCallback callback) {
-    handlers_[packetType] = callback;
-}
-
-void PacketHandler::RegisterDefaultHandlers() {
-    // 인증 패킷 (SSL)
-    RegisterHandler(PKT_SIGNUP_OK, [this](const std::string& data) { HandleSignupOk(data); });
-    RegisterHandler(PKT_SIGNUP_ERROR, [this](const std::string& data) { HandleError(data); });
-    RegisterHandler(PKT_LOGIN_OK, [this](const std::string& data) { HandleLoginOk(data); });
-    RegisterHandler(PKT_LOGIN_NO_ACCOUNT, [this](const std::string& data) { HandleLoginFailure("Account not found"); });
-    RegisterHandler(PKT_LOGIN_WRONG_PW, [this](const std::string& data) { HandleLoginFailure("Wrong password"); });
-    RegisterHandler(PKT_LOGIN_SUSPENDED, [this](const std::string& data) { HandleLoginFailure("Account suspended"); });
-    RegisterHandler(PKT_LOGIN_ERROR, [this](const std::string& data) { HandleLoginFailure("Login error"); });
-    RegisterHandler(PKT_NICKNAME_EDIT_OK, [this](const std::string& data) { HandleError(data); });
-    RegisterHandler(PKT_SIGNUP_DUPLICATE, [this](const std::string& data) { HandleError(data); });
-    RegisterHandler(PKT_NICKNAME_EDIT_ERROR, [this](const std::string& data) { HandleError(data); });
-    RegisterHandler(PKT_CHECK_ID_DUPLICATE, [this](const std::string& data) { HandleError(data); });
-    RegisterHandler(PKT_CHECK_ID_OK, [this](const std::string& data) { HandleError(data); });
-
-    // 사용자 정보 패킷 (TCP)
-    // server sends TOKEN_VALID|nickname for validated tokens / profile info
-    RegisterHandler(PKT_TOKEN_VALID, [this](const std::string& data) { HandleUserProfile(data); });
-    RegisterHandler(PKT_INVALID_TOKEN, [this](const std::string& data) { HandleInvalidToken(data); });
-    // Authentication errors (server may send AUTH_ERROR|reason)
-    RegisterHandler(PKT_AUTH_ERROR, [this](const std::string& data) { HandleError(data); });
-    RegisterHandler(PKT_SIGNUP_DUPLICATE, [this](const std::string& data) { HandleError(data); });
-    RegisterHandler(PKT_NICKNAME_EDIT_OK, [this](const std::string& data) { HandleError(data); });
-
-    // 게임 프로토콜 패킷
-    RegisterHandler(PKT_WAIT_REPLY, [this](const std::string& data) { HandleWaitReply(data); });
-    RegisterHandler(PKT_QUEUE_FULL, [this](const std::string& data) { HandleQueueFull(data); });
-    RegisterHandler(PKT_SESSION_ACK, [this](const std::string& data) { HandleError(data); });
-    RegisterHandler(PKT_SESSION_NOT_FOUND, [this](const std::string& data) { HandleError(data); });
-    RegisterHandler(PKT_GAME_INIT, [this](const std::string& data) { HandleGameInit(data); });
-    RegisterHandler(PKT_GAME_START, [this](const std::string& data) { HandleGameStart(data); });
-    RegisterHandler(PKT_ALL_CARDS, [this](const std::string& data) { HandleAllCards(data); });
-    RegisterHandler(PKT_ROLE_INFO, [this](const std::string& data) { HandleRoleInfo(data); });
-    RegisterHandler(PKT_TURN_UPDATE, [this](const std::string& data) { HandleTurnUpdate(data); });
-    RegisterHandler(PKT_HINT_MSG, [this](const std::string& data) { HandleHintMsg(data); });
-    RegisterHandler(PKT_CARD_UPDATE, [this](const std::string& data) { HandleCardUpdate(data); });
-    RegisterHandler(PKT_CHAT_MSG, [this](const std::string& data) { HandleChatMsg(data); });
-    RegisterHandler(PKT_GAME_OVER, [this](const std::string& data) { HandleGameOver(data); });
-
-    // 기타
-    RegisterHandler(PKT_ERROR, [this](const std::string& data) { HandleError(data); });
 }
 
 void PacketHandler::ProcessPacket(const std::string& packet) {
@@ -66,64 +17,74 @@ void PacketHandler::ProcessPacket(const std::string& packet) {
         return;
     }
 
-    size_t delimiterPos = packet.find('|');
-    
-    std::string packetType;
-    if (delimiterPos == std::string::npos) {
-        // 데이터가 없는 패킷 (예: "ERROR", "INVALID_TOKEN")
-        packetType = packet;
-    } else {
-        packetType = packet.substr(0, delimiterPos);
-    }
-
-    // 해당 패킷 타입의 핸들러 찾기
-    auto it = handlers_.find(packetType);
-    
-    if (it == handlers_.end()) {
-        std::cerr << "No handler registered for packet type: " << packetType << std::endl;
+    static constexpr auto handlers = PacketOpcode::MakeTable<Handler>({
+        // 인증 패킷
+        { Opcode::SIGNUP_OK,           &PacketHandler::HandleSignupOk },
+        { Opcode::SIGNUP_ERROR,        &PacketHandler::HandleError },
+        { Opcode::SIGNUP_DUPLICATE,    &PacketHandler::HandleError },
+        { Opcode::LOGIN_OK,            &PacketHandler::HandleLoginOk },
+        { Opcode::LOGIN_NO_ACCOUNT,    &PacketHandler::HandleLoginNoAccount },
+        { Opcode::LOGIN_WRONG_PW,      &PacketHandler::HandleLoginWrongPassword },
+        { Opcode::LOGIN_SUSPENDED,     &PacketHandler::HandleLoginSuspended },
+        { Opcode::LOGIN_ERROR,         &PacketHandler::HandleLoginError },
+        { Opcode::NICKNAME_EDIT_OK,    &PacketHandler::HandleError },
+        { Opcode::NICKNAME_EDIT_ERROR, &PacketHandler::HandleError },
+        { Opcode::CHECK_ID_DUPLICATE,  &PacketHandler::HandleError },
+        { Opcode::CHECK_ID_OK,         &PacketHandler::HandleError },
+
+        // 사용자 정보 패킷
+        // server sends TOKEN_VALID|nickname for validated tokens / profile info
+        { Opcode::TOKEN_VALID,         &PacketHandler::HandleUserProfile },
+        { Opcode::INVALID_TOKEN,       &PacketHandler::HandleInvalidToken },
+        // Authentication errors (server sends AUTH_ERROR|UNKNOWN_PACKET)
+        { Opcode::AUTH_ERROR_UNKNOWN,  &PacketHandler::HandleError },
+
+        // 게임 프로토콜 패킷
+        { Opcode::WAIT_REPLY,          &PacketHandler::HandleWaitReply },
+        { Opcode::QUEUE_FULL,          &PacketHandler::HandleQueueFull },
+        { Opcode::SESSION_ACK,         &PacketHandler::HandleError },
+        { Opcode::SESSION_NOT_FOUND,   &PacketHandler::HandleError },
+        { Opcode::GAME_INIT,           &PacketHandler::HandleGameInit },
+        { Opcode::GAME_START,          &PacketHandler::HandleGameStart },
+        { Opcode::ALL_CARDS,           &PacketHandler::HandleAllCards },
+        { Opcode::ROLE_INFO,           &PacketHandler::HandleRoleInfo },
+        { Opcode::TURN_UPDATE,         &PacketHandler::HandleTurnUpdate },
+        { Opcode::HINT,                &PacketHandler::HandleHintMsg },
+        { Opcode::CARD_UPDATE,         &PacketHandler::HandleCardUpdate },
+        { Opcode::CHAT,                &PacketHandler::HandleChatMsg },
+        { Opcode::GAME_OVER,           &PacketHandler::HandleGameOver },
+
+        // 기타
+        { Opcode::GENERIC_ERROR,       &PacketHandler::HandleError },
+    });
+
+    // 패킷 이름은 잘라내지 않고 해시 한 번으로 opcode를 찾음
+    std::string_view fields;
+    bool hasFields = false;
+    Opcode opcode = PacketOpcode::Lookup(packet, fields, hasFields);
+    Handler handler = handlers[static_cast<size_t>(opcode)];
+    if (!handler) {
+        std::cerr << "No handler registered for packet type: "
+                  << packet.substr(0, packet.find('|')) << std::endl;
         return;
     }
 
-    // 데이터 추출 (파이프 이후)
-    std::string packetData;
-    if (delimiterPos != std::string::npos) {
-        packetData = packet.substr(delimiterPos + 1);
-    }
+    // 필드는 한 번에 나눠서 넘김 (packet을 가리키는 조각 - 복사 없음)
+    Packet::Fields packetFields(fields);
 
-    // 등록된 핸들러 호출
+    // 핸들러 호출
     try {
-        it->second(packetData);
+        (this->*handler)(packetFields);
     } catch (const std::exception& e) {
-        std::cerr << "Error processing packet " << packetType << ": " << e.what() << std::endl;
-    }
-}
-
-std::string PacketHandler::ParseField(const std::string& data, int fieldIndex, const std::string& delimiter) {
-    size_t startPos = 0;
-    int currentField = 0;
-
-    while (currentField < fieldIndex && startPos < data.size()) {
-        startPos = data.find(delimiter, startPos) + delimiter.size();
-        currentField++;
-    }
-
-    if (currentField != fieldIndex) {
-        return "";  // 필드를 찾지 못함
-    }
-
-    size_t endPos = data.find(delimiter, startPos);
-    if (endPos == std::string::npos) {
-        return data.substr(startPos);  // 마지막 필드
+        std::cerr << "Error processing packet " << PacketOpcode::Name(opcode) << ": " << e.what() << std::endl;
     }
-
-    return data.substr(startPos, endPos - startPos);
 }
 
 // ==================== 인증 패킷 핸들러 ====================
 
-void PacketHandler::HandleSignupOk(const std::string& data) {
+void PacketHandler::HandleSignupOk(const Packet::Fields& fields) {
     // SIGNUP_OK|token
-    std::string token = ParseField(data, 0, "|");
+    std::string token(fields[0]);
     if (!token.empty()) {
         gameState_->token = token;
         gameState_->SetPhase(GamePhase::LOBBY);
@@ -131,9 +92,9 @@ void PacketHandler::HandleSignupOk(const std::string& data) {
     }
 }
 
-void PacketHandler::HandleLoginOk(const std::string& data) {
+void PacketHandler::HandleLoginOk(const Packet::Fields& fields) {
     // LOGIN_OK|token
-    std::string token = ParseField(data, 0, "|");
+    std::string token(fields[0]);
     if (!token.empty()) {
         gameState_->token = token;
         gameState_->SetPhase(GamePhase::LOBBY);
@@ -141,7 +102,7 @@ void PacketHandler::HandleLoginOk(const std::string& data) {
     }
 }
 
-void PacketHandler::HandleInvalidToken(const std::string& data) {
+void PacketHandler::HandleInvalidToken(const Packet::Fields& fields) {
     // INVALID_TOKEN
     gameState_->SetPhase(GamePhase::ERROR_PHASE);
     Logger::Warn("Invalid token. Please login again.");
@@ -149,9 +110,9 @@ void PacketHandler::HandleInvalidToken(const std::string& data) {
 
 // ==================== 사용자 정보 패킷 핸들러 ====================
 
-void PacketHandler::HandleUserProfile(const std::string& data) {
+void PacketHandler::HandleUserProfile(const Packet::Fields& fields) {
     // TOKEN_VALID|nickname  (server currently sends TOKEN_VALID with nickname)
-    std::string nickname = ParseField(data, 0, "|");
+    std::string nickname(fields[0]);
 
     if (!nickname.empty()) {
         gameState_->username = nickname;
@@ -161,16 +122,15 @@ void PacketHandler::HandleUserProfile(const std::string& data) {
 
 // ==================== 게임 프로토콜 핸들러 ====================
 
-void PacketHandler::HandleWaitReply(const std::string& data) {
+void PacketHandler::HandleWaitReply(const Packet::Fields& fields) {
     // WAIT_REPLY|playerCount
     // spec: WAIT_REPLY|playerCount|maxPlayers
-    std::string countStr = ParseField(data, 0, "|");
-    std::string maxStr = ParseField(data, 1, "|");
-    if (!countStr.empty()) {
-        int count = std::stoi(countStr);
+    int count = 0;
+    if (fields.GetInt(0, count)) {
         gameState_->matchingCount = count;
-        if (!maxStr.empty()) {
-            gameState_->matchingMax = std::stoi(maxStr);
+        int maxPlayers = 0;
+        if (fields.GetInt(1, maxPlayers)) {
+            gameState_->matchingMax = maxPlayers;
         }
         // 저장: GUI가 이를 읽어 진행 바를 그리도록 함
         gameState_->SetPhase(GamePhase::MATCHING);
@@ -179,15 +139,15 @@ void PacketHandler::HandleWaitReply(const std::string& data) {
     }
 }
 
-void PacketHandler::HandleQueueFull(const std::string& data) {
+void PacketHandler::HandleQueueFull(const Packet::Fields& fields) {
     // QUEUE_FULL
     gameState_->SetPhase(GamePhase::MATCHING);
     Logger::Info("Queue full! Game starting...");
 }
 
-void PacketHandler::HandleGameInit(const std::string& data) {
+void PacketHandler::HandleGameInit(const Packet::Fields& fields) {
     // GAME_INIT|nick1|role1|team1|leader1|nick2|role2|team2|leader2|...
-    Logger::Info(std::string("HandleGameInit received: ") + data);
+    Logger::Info(std::string("HandleGameInit received: ") + std::string(fields.Rest(0)));
     
     std::vector<Player> players;
     
@@ -197,29 +157,32 @@ void PacketHandler::HandleGameInit(const std::string& data) {
     int myIndex = -1;
     
     for (int i = 0; i < 6; ++i) {  // Original C 버전은 6명까지 지원
-        int baseField = i * 4;
-        std::string nick = ParseField(data, baseField, "|");
-        std::string roleStr = ParseField(data, baseField + 1, "|");
-        std::string teamStr = ParseField(data, baseField + 2, "|");
-        std::string leaderStr = ParseField(data, baseField + 3, "|");
+        size_t baseField = static_cast<size_t>(i) * 4;
+        std::string_view nick = fields[baseField];
+        if (nick.empty()) continue;
+
+        int role = 0, team = 0, leader = 0;
+        if (!fields.GetInt(baseField + 1, role) || !fields.GetInt(baseField + 2, team) ||
+            !fields.GetInt(baseField + 3, leader)) {
+            Logger::Warn(std::string("GAME_INIT: invalid fields for player ") + std::to_string(i));
+            continue;
+        }
+
+        Player p;
+        p.nickname = std::string(nick);
+        p.role = (role % 2 == 0) ? PlayerRole::SPYMASTER : PlayerRole::AGENT;
+        p.team = team;
+        p.isLeader = (leader == 1);
+        p.isReady = false;
+        players.push_back(p);
         
-        if (!nick.empty()) {
-            Player p;
-            p.nickname = nick;
-            p.role = (std::stoi(roleStr) % 2 == 0) ? PlayerRole::SPYMASTER : PlayerRole::AGENT;
-            p.team = std::stoi(teamStr);
-            p.isLeader = (std::stoi(leaderStr) == 1);
-            p.isReady = false;
-            players.push_back(p);
-            
-            Logger::Info(std::string("Player ") + std::to_string(i) + ": '" + nick + 
-                        "', team=" + teamStr + ", leader=" + leaderStr);
-            
-            // 자신의 닉네임과 매칭되면 myPlayerIndex 설정
-            if (nick == myNickname) {
-                myIndex = i;
-                Logger::Info(std::string("*** MATCH FOUND at index ") + std::to_string(i) + " ***");
-            }
+        Logger::Info(std::string("Player ") + std::to_string(i) + ": '" + p.nickname + 
+                    "', team=" + std::to_string(team) + ", leader=" + std::to_string(leader));
+        
+        // 자신의 닉네임과 매칭되면 myPlayerIndex 설정
+        if (p.nickname == myNickname) {
+            myIndex = i;
+            Logger::Info(std::string("*** MATCH FOUND at index ") + std::to_string(i) + " ***");
         }
     }
     
@@ -240,41 +203,44 @@ void PacketHandler::HandleGameInit(const std::string& data) {
     Logger::Info(std::string("Game initialized with ") + std::to_string(players.size()) + " players");
 }
 
-void PacketHandler::HandleGameStart(const std::string& data) {
-    // GAME_START|sessionId
-    std::string sessionIdStr = ParseField(data, 0, "|");
-    if (!sessionIdStr.empty()) {
-        gameState_->sessionId = std::stoi(sessionIdStr);
+void PacketHandler::HandleGameStart(const Packet::Fields& fields) {
+    // GAME_START|sessionId (서버는 시작 시각 ms를 보냄 - int 범위를 넘음)
+    long long sessionId = 0;
+    if (fields.GetInt(0, sessionId)) {
+        gameState_->sessionId = sessionId;
         gameState_->SetPhase(GamePhase::PLAYING);
         Logger::Info(std::string("Game started. Session ID: ") + std::to_string(gameState_->sessionId));
     }
 }
 
-void PacketHandler::HandleAllCards(const std::string& data) {
+void PacketHandler::HandleAllCards(const Packet::Fields& fields) {
     // ALL_CARDS|word1|type1|isUsed1|word2|type2|isUsed2|...
     Logger::Info(std::string("ALL_CARDS received - parsing..."));
     
     std::vector<GameCard> cards;
     
     for (int i = 0; i < 25; ++i) {
-        int baseField = i * 3;
-        std::string word = ParseField(data, baseField, "|");
-        std::string typeStr = ParseField(data, baseField + 1, "|");
-        std::string usedStr = ParseField(data, baseField + 2, "|");
+        size_t baseField = static_cast<size_t>(i) * 3;
+        std::string_view word = fields[baseField];
+        if (word.empty()) continue;
+
+        int cardType = 0, used = 0;
+        if (!fields.GetInt(baseField + 1, cardType) || !fields.GetInt(baseField + 2, used)) {
+            Logger::Warn(std::string("ALL_CARDS: invalid fields for card ") + std::to_string(i));
+            continue;
+        }
+
+        GameCard c;
+        c.word = std::string(word);
+        c.cardType = cardType;
+        c.isRevealed = (used == 1);
+        cards.push_back(c);
         
-        if (!word.empty()) {
-            GameCard c;
-            c.word = word;
-            c.cardType = std::stoi(typeStr);
-            c.isRevealed = (std::stoi(usedStr) == 1);
-            cards.push_back(c);
-            
-            // 디버깅: revealed 카드 로그
-            if (c.isRevealed) {
-                Logger::Info(std::string("Card[") + std::to_string(i) + 
-                            "] is already revealed: " + c.word + 
-                            " (type=" + std::to_string(c.cardType) + ")");
-            }
+        // 디버깅: revealed 카드 로그
+        if (c.isRevealed) {
+            Logger::Info(std::string("Card[") + std::to_string(i) + 
+                        "] is already revealed: " + c.word + 
+                        " (type=" + std::to_string(c.cardType) + ")");
         }
     }
 
@@ -282,12 +248,11 @@ void PacketHandler::HandleAllCards(const std::string& data) {
     Logger::Info(std::string("Received ") + std::to_string(cards.size()) + " cards");
 }
 
-void PacketHandler::HandleRoleInfo(const std::string& data) {
+void PacketHandler::HandleRoleInfo(const Packet::Fields& fields) {
     // ROLE_INFO|roleNumber (0-3)
     // 이 패킷은 GAME_INIT 이후에 오므로, 이미 설정된 정보와 일치하는지 검증
-    std::string roleStr = ParseField(data, 0, "|");
-    if (!roleStr.empty()) {
-        int role = std::stoi(roleStr);
+    int role = 0;
+    if (fields.GetInt(0, role)) {
         gameState_->myRole = role;
         
         // GAME_INIT에서 이미 설정되었지만, 백업으로 다시 설정
@@ -303,51 +268,40 @@ void PacketHandler::HandleRoleInfo(const std::string& data) {
     }
 }
 
-void PacketHandler::HandleTurnUpdate(const std::string& data) {
+void PacketHandler::HandleTurnUpdate(const Packet::Fields& fields) {
     // TURN_UPDATE|team|phase|redScore|blueScore
-    std::string teamStr = ParseField(data, 0, "|");
-    std::string phaseStr = ParseField(data, 1, "|");
-    std::string redStr = ParseField(data, 2, "|");
-    std::string blueStr = ParseField(data, 3, "|");
-    
-    if (!teamStr.empty() && !redStr.empty() && !blueStr.empty()) {
-        gameState_->inGameStep = std::stoi(phaseStr);
-        gameState_->SetTurn(std::stoi(teamStr));
-        gameState_->UpdateScore(std::stoi(redStr), std::stoi(blueStr));
+    int team = 0, phase = 0, red = 0, blue = 0;
+    if (fields.GetInt(0, team) && fields.GetInt(1, phase) && fields.GetInt(2, red) && fields.GetInt(3, blue)) {
+        gameState_->inGameStep = phase;
+        gameState_->SetTurn(team);
+        gameState_->UpdateScore(red, blue);
     }
 }
 
-void PacketHandler::HandleHintMsg(const std::string& data) {
+void PacketHandler::HandleHintMsg(const Packet::Fields& fields) {
     // HINT|team|word|count
-    std::string teamStr = ParseField(data, 0, "|");
-    std::string word = ParseField(data, 1, "|");
-    std::string countStr = ParseField(data, 2, "|");
+    std::string word(fields[1]);
+    int count = 0;
     
-    if (!word.empty() && !countStr.empty()) {
-        int count = std::stoi(countStr);
+    if (!word.empty() && fields.GetInt(2, count)) {
         gameState_->SetHint(word, count);
         gameState_->remainingTries = count;  // 남은 시도 횟수 초기화
-        Logger::Info(std::string("Hint received: ") + word + " (" + countStr + ")");
+        Logger::Info(std::string("Hint received: ") + word + " (" + std::to_string(count) + ")");
     }
 }
 
-void PacketHandler::HandleCardUpdate(const std::string& data) {
+void PacketHandler::HandleCardUpdate(const Packet::Fields& fields) {
     // CARD_UPDATE|cardIndex|isUsed|remainingTries
-    std::string indexStr = ParseField(data, 0, "|");
-    std::string usedStr = ParseField(data, 1, "|");
-    std::string triesStr = ParseField(data, 2, "|");
+    Logger::Info(std::string("CARD_UPDATE received: ") + std::string(fields.Rest(0)));
     
-    Logger::Info(std::string("CARD_UPDATE received: ") + data);
-    
-    if (!indexStr.empty()) {
-        int index = std::stoi(indexStr);
-        int isUsed = usedStr.empty() ? 0 : std::stoi(usedStr);
-        
+    int index = 0;
+    if (fields.GetInt(0, index)) {
         gameState_->RevealCard(index);
         
         // remainingTries 업데이트 (서버에서 전송)
-        if (!triesStr.empty()) {
-            gameState_->remainingTries = std::stoi(triesStr);
+        int tries = 0;
+        if (fields.GetInt(2, tries)) {
+            gameState_->remainingTries = tries;
             Logger::Info(std::string("Card revealed: ") + std::to_string(index) + 
                         ", Remaining tries: " + std::to_string(gameState_->remainingTries));
         } else {
@@ -356,30 +310,29 @@ void PacketHandler::HandleCardUpdate(const std::string& data) {
     }
 }
 
-void PacketHandler::HandleChatMsg(const std::string& data) {
-    // CHAT|team|roleNum|nickname|message
-    std::string teamStr = ParseField(data, 0, "|");
-    std::string roleStr = ParseField(data, 1, "|");
-    std::string nickname = ParseField(data, 2, "|");
-    std::string message = ParseField(data, 3, "|");
+void PacketHandler::HandleChatMsg(const Packet::Fields& fields) {
+    // CHAT|team|roleNum|nickname|message (메시지에는 '|'가 들어갈 수 있음)
+    std::string nickname(fields[2]);
+    std::string message(fields.Rest(3));
     
     if (!nickname.empty() && !message.empty()) {
         GameMessage msg;
         msg.nickname = nickname;
         msg.message = message;
-        msg.team = teamStr.empty() ? 999 : std::stoi(teamStr);
+        if (!fields.GetInt(0, msg.team)) {
+            msg.team = 999;
+        }
         
         gameState_->AddMessage(msg);
         Logger::Info(std::string("[") + nickname + "]: " + message);
     }
 }
 
-void PacketHandler::HandleGameOver(const std::string& data) {
+void PacketHandler::HandleGameOver(const Packet::Fields& fields) {
     // GAME_OVER|winnerTeam (0: RED, 1: BLUE, -1: DRAW)
-    std::string winnerStr = ParseField(data, 0, "|");
+    int winner = 0;
     
-    if (!winnerStr.empty()) {
-        int winner = std::stoi(winnerStr);
+    if (fields.GetInt(0, winner)) {
         std::string winnerName = (winner == 0) ? "RED" : 
                                 (winner == 1) ? "BLUE" : "DRAW";
         
@@ -399,7 +352,7 @@ void PacketHandler::HandleGameOver(const std::string& data) {
 
 // ==================== 기타 핸들러 ====================
 
-void PacketHandler::HandleError(const std::string& data) {
+void PacketHandler::HandleError(const Packet::Fields& fields) {
     // ERROR
     gameState_->SetPhase(GamePhase::ERROR_PHASE);
     Logger::Error("Server error occurred");
@@ -413,3 +366,19 @@ void PacketHandler::HandleLoginFailure(const std::string& reason) {
     Logger::Warn(std::string("Login failed: ") + reason);
     ConsoleUtils::SetStatus(std::string("Login failed: ") + reason);
 }
+
+void PacketHandler::HandleLoginNoAccount(const Packet::Fields&) {
+    HandleLoginFailure("Account not found");
+}
+
+void PacketHandler::HandleLoginWrongPassword(const Packet::Fields&) {
+    HandleLoginFailure("Wrong password");
+}
+
+void PacketHandler::HandleLoginSuspended(const Packet::Fields&) {
+    HandleLoginFailure("Account suspended");
+}
+
+void PacketHandler::HandleLoginError(const Packet::Fields&) {
+    HandleLoginFailure("Login error");
+}
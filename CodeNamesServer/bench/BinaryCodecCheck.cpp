@@ -0,0 +1,304 @@
+// 바이너리 코덱 왕복 검사 (BinaryCodec.h)
+//  - 표의 모든 메시지를 방향별로 텍스트 -> 프레임 -> 텍스트로 돌려 원문과 같은지 (바이너리로 실렸는지도 확인)
+//  - 표에 없거나 스키마에 맞지 않는 메시지는 OP_RAW로 실리고 그대로 돌아오는지
+//  - 잘린 / 잘못된 본문 (varint, 문자열 길이, 고정 정수, 반복 그룹 개수, ? 표시, '|' 든 s 필드)은 Decode가 거부하는지
+//  - 프레임 헤더 (ReadHeader / ExtractFrame)의 INCOMPLETE / MALFORMED 경계
+// 서버 코덱과 클라이언트 코덱(CodeNamesClient/src/core/BinaryCodec.cpp)을 각각 같은 검사로 빌드함
+// 새 메시지를 표에 넣으면 여기 SERVER_BOUND / CLIENT_BOUND에도 한 줄 추가
+// 빌드: cmake -DCODENAMES_BUILD_BENCH=ON, 실행: BinaryCodecCheck / BinaryCodecClientCheck (실패가 있으면 종료 코드 1)
+#include "BinaryCodec.h"
+#include "PacketProtocol.h"
+
+#include <cstdint>
+#include <initializer_list>
+#include <iostream>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace {
+    using BinaryCodec::Direction;
+    using BinaryCodec::FrameStatus;
+
+    constexpr size_t MAX_BODY = 8192;
+
+    int g_checks = 0;
+    int g_failures = 0;
+
+    void Check(bool ok, const std::string& what) {
+        ++g_checks;
+        if (!ok) {
+            ++g_failures;
+            std::cout << "FAIL: " << what << std::endl;
+        }
+    }
+
+    const char* Name(Direction direction) {
+        return direction == Direction::TO_CLIENT ? "to client" : "to server";
+    }
+
+    std::string P(const char* name, const std::string& fields = std::string()) {
+        return fields.empty() ? std::string(name) : std::string(name) + "|" + fields;
+    }
+
+    // 보이지 않는 바이트도 알아볼 수 있게 (실패 메시지용)
+    std::string Printable(std::string_view text) {
+        static const char HEX[] = "0123456789abcdef";
+        std::string out;
+        for (char c : text) {
+            uint8_t byte = static_cast<uint8_t>(c);
+            if (byte >= 0x20 && byte < 0x7F) {
+                out.push_back(c);
+            } else {
+                out += "\\x";
+                out.push_back(HEX[byte >> 4]);
+                out.push_back(HEX[byte & 0x0F]);
+            }
+        }
+        return out;
+    }
+
+    std::string Body(std::initializer_list<int> bytes) {
+        std::string body;
+        for (int byte : bytes) body.push_back(static_cast<char>(byte));
+        return body;
+    }
+
+    std::string String(std::string_view text) {
+        std::string out;
+        BinaryCodec::WriteVarint(static_cast<uint32_t>(text.size()), out);
+        out.append(text);
+        return out;
+    }
+
+    // 인코드 -> 헤더 분리 -> 디코드 (expectRaw: OP_RAW로 실려야 하는지)
+    void RoundTrip(const std::string& text, Direction direction, bool expectRaw) {
+        std::string label = std::string(Name(direction)) + " \"" + Printable(text) + "\"";
+
+        std::string frame;
+        BinaryCodec::Encode(text, direction, frame);
+
+        const char* data = frame.data();
+        size_t length = frame.size();
+        std::string_view body;
+        if (BinaryCodec::ExtractFrame(data, length, MAX_BODY, body) != FrameStatus::OK || length != 0) {
+            Check(false, label + ": 프레임 하나로 꺼내지지 않음");
+            return;
+        }
+
+        bool raw = static_cast<uint8_t>(body[0]) == BinaryCodec::OP_RAW;
+        Check(raw == expectRaw, label + (expectRaw ? ": RAW로 실려야 함" : ": 바이너리로 실려야 함 (RAW로 감)"));
+
+        std::string decoded;
+        bool ok = BinaryCodec::Decode(body, direction, decoded);
+        Check(ok && decoded == text, label + ": 왕복 결과 \"" + Printable(decoded) + "\"");
+    }
+
+    void Rejects(const std::string& body, Direction direction, const char* what) {
+        std::string decoded;
+        Check(!BinaryCodec::Decode(body, direction, decoded),
+              std::string(Name(direction)) + " " + what + ": 거부해야 함 (본문 " + Printable(body) + ")");
+    }
+
+    std::string Repeat(const std::string& group, int count) {
+        std::string fields;
+        for (int i = 0; i < count; ++i) {
+            if (i > 0) fields += "|";
+            fields += group;
+        }
+        return fields;
+    }
+
+    // client -> server 스키마 전부 (r 필드는 '|'가 든 값도)
+    const std::vector<std::string> SERVER_BOUND = {
+        P(PKT_CMD_QUERY_WAIT, "0123456789abcdef"),
+        P(PKT_HEARTBEAT),
+        P(PKT_PROTO, PKT_PROTO_BINARY),
+        P(PKT_CHECK_ID, "alice"),
+        P(PKT_CHECK_ID, "a|b"),
+        P(PKT_SIGNUP, "alice|pw|Alice"),
+        P(PKT_SIGNUP, "alice|pw|Al|ice"),
+        P(PKT_SIGNUP, "||"),
+        P(PKT_LOGIN, "alice|p|w"),
+        P(PKT_TOKEN, "0123456789abcdef"),
+        P(PKT_EDIT_NICK, "0123456789abcdef|새 닉네임"),
+        P(PKT_HINT_MSG, "animal|2"),
+        P(PKT_HINT_MSG, "animal|-1"),
+        P(PKT_CHAT, "hello|with|pipes 한글"),
+        std::string(PKT_CHAT) + "|",
+        P(PKT_ANSWER, "tiger"),
+        P(PKT_MATCHING_CANCEL, "0123456789abcdef"),
+        P(PKT_SESSION_READY, "0123456789abcdef"),
+        P(PKT_READY_TO_GO),
+        P(PKT_GET_ROLE),
+        P(PKT_GET_ALL_CARDS),
+        P(PKT_REPORT, "0123456789abcdef|Bob"),
+    };
+
+    // server -> client 스키마 전부 (정수 경계값, 128바이트 넘는 본문 = 2바이트 헤더 포함)
+    const std::vector<std::string> CLIENT_BOUND = {
+        P(PKT_WAIT_REPLY, "3|4"),
+        P(PKT_QUEUE_FULL),
+        P(PKT_QUEUE_ERROR),
+        P(PKT_INVALID_TOKEN),
+        P(PKT_SESSION_ACK),
+        P(PKT_SESSION_NOT_FOUND),
+        P(PKT_CANCEL_OK),
+        P(PKT_LOBBY_ERROR_UNKNOWN),
+        P(PKT_PROTO_OK, PKT_PROTO_BINARY),
+        P(PKT_CHECK_ID_DUPLICATE),
+        P(PKT_CHECK_ID_OK),
+        P(PKT_CHECK_ID_ERROR),
+        P(PKT_SIGNUP_OK, "Alice"),
+        P(PKT_SIGNUP_DUPLICATE),
+        P(PKT_SIGNUP_ERROR),
+        P(PKT_LOGIN_OK, "0123456789abcdef"),
+        P(PKT_LOGIN_NO_ACCOUNT),
+        P(PKT_LOGIN_WRONG_PW),
+        P(PKT_LOGIN_SUSPENDED),
+        P(PKT_LOGIN_ERROR),
+        P(PKT_TOKEN_VALID, "Al|ice"),
+        P(PKT_NICKNAME_EDIT_OK),
+        P(PKT_NICKNAME_EDIT_ERROR),
+        P(PKT_AUTH_ERROR_UNKNOWN),
+        P(PKT_GAME_INIT, "Alice|0|0|1|Bob|1|0|0|Carol|2|1|1|Dave|3|1|0|EMPTY|0|0|0|EMPTY|0|0|0"),
+        P(PKT_ALL_CARDS, Repeat("호랑이|2|0", 25)),
+        P(PKT_CARD_UPDATE, "2147483647|-2147483648|0"),
+        P(PKT_TURN_UPDATE, "0|1|3|-1"),
+        P(PKT_HINT_MSG, "0|animal|2"),
+        P(PKT_CHAT, "0|1|Alice|hello|with|pipes"),
+        P(PKT_ANSWER_RESULT, "CORRECT|tiger"),
+        P(PKT_GAME_OVER, "1"),
+        P(PKT_GAME_NOT_IMPLEMENTED),
+        P(PKT_GAME_CREATE_ERROR),
+        P(PKT_GAME_ERROR),
+        P(PKT_SERVER_BUSY),
+        P(PKT_RATE_LIMITED, "CHAT"),
+        P(PKT_ERROR),
+        P(PKT_GAME_START, "1700000000000"),
+        P(PKT_GAME_START, "-9223372036854775808"),
+        P(PKT_GAME_FAILED, "not|enough players"),
+        P(PKT_ROLE_INFO, "2"),
+        P(PKT_EVENT_QUEUE_FULL),
+        P(PKT_REPORT_OK, "3"),
+        P(PKT_REPORT_OK, "3|SUSPENDED"),
+        P(PKT_REPORT_ERROR, "not found"),
+    };
+
+    // 그대로 텍스트로 실려야 하는 메시지 (표에 없음 / 반대 방향 / 스키마와 다른 필드)
+    const std::vector<std::pair<std::string, Direction>> RAW_FALLBACK = {
+        { "UNKNOWN_PACKET|x", Direction::TO_CLIENT },
+        { "UNKNOWN_COMMAND", Direction::TO_SERVER },
+        { P(PKT_SIGNUP_OK, "Alice"), Direction::TO_SERVER },
+        { P(PKT_SIGNUP, "alice|pw|Alice"), Direction::TO_CLIENT },
+        { P(PKT_WAIT_REPLY, "007|1"), Direction::TO_CLIENT },        // 0으로 시작하는 정수
+        { P(PKT_WAIT_REPLY, "-0|1"), Direction::TO_CLIENT },
+        { P(PKT_WAIT_REPLY, "+1|1"), Direction::TO_CLIENT },
+        { P(PKT_WAIT_REPLY, "2147483648|1"), Direction::TO_CLIENT }, // int32 범위 밖
+        { P(PKT_WAIT_REPLY, "1"), Direction::TO_CLIENT },            // 필드 부족
+        { P(PKT_WAIT_REPLY, "1|2|3"), Direction::TO_CLIENT },        // 필드 남음
+        { P(PKT_GAME_OVER, "RED"), Direction::TO_CLIENT },
+        { P(PKT_GAME_INIT, "Alice|0|0"), Direction::TO_CLIENT },     // 그룹 크기의 배수가 아님
+        { P(PKT_GAME_INIT, "Al|ice|0|0|1"), Direction::TO_CLIENT },  // s 필드의 '|'는 필드가 하나 늘어난 것과 같음
+        { P(PKT_TOKEN, "a|b"), Direction::TO_SERVER },
+        { P(PKT_REPORT_OK, "3|SUSPENDED|x"), Direction::TO_CLIENT },
+    };
+
+    void CheckRoundTrips() {
+        for (const std::string& text : SERVER_BOUND) RoundTrip(text, Direction::TO_SERVER, false);
+        for (const std::string& text : CLIENT_BOUND) RoundTrip(text, Direction::TO_CLIENT, false);
+        for (const auto& [text, direction] : RAW_FALLBACK) RoundTrip(text, direction, true);
+    }
+
+    void CheckMalformedBodies() {
+        const Direction C = Direction::TO_CLIENT;
+        const Direction S = Direction::TO_SERVER;
+
+        Rejects(std::string(), S, "빈 본문");
+        Rejects(Body({ 0xFF }), S, "표에 없는 opcode");
+        Rejects(Body({ 0x14 }) + String("a") + String("b") + String("c"), C, "반대 방향 opcode (SIGNUP)");
+
+        // RAW
+        Rejects(Body({ 0x00 }), S, "빈 RAW");
+        Rejects(Body({ 0x00 }) + "PING\nPING", S, "구분자가 든 RAW");
+
+        // 문자열 길이 varint / 문자열 본문
+        Rejects(Body({ 0x10, 0x80 }), S, "잘린 길이 varint");
+        Rejects(Body({ 0x10, 0x80, 0x80, 0x80, 0x80, 0x80, 0x01 }), S, "5바이트를 넘는 길이 varint");
+        Rejects(Body({ 0x10, 0x05, 'a' }), S, "길이보다 짧은 문자열");
+        Rejects(Body({ 0x14 }) + String("a|b") + String("pw") + String("nick"), S, "'|'가 든 s 필드");
+        Rejects(Body({ 0x10 }) + String("a\nb"), S, "구분자가 든 r 필드");
+        Rejects(Body({ 0x14 }) + String("alice") + String("pw"), S, "필드 부족");
+        Rejects(Body({ 0x1E }) + String("token") + "x", S, "남는 바이트");
+
+        // 고정 정수
+        Rejects(Body({ 0x02, 1, 0, 0, 0, 2, 0, 0 }), C, "잘린 int32");
+        Rejects(Body({ 0x55, 0, 0, 0, 0, 0, 0, 0 }), C, "잘린 int64");
+
+        // 반복 그룹 개수
+        Rejects(Body({ 0x30 }), C, "그룹 개수 없음");
+        Rejects(Body({ 0x30, 0x80 }), C, "잘린 그룹 개수 varint");
+        Rejects(Body({ 0x30, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F }), C, "본문보다 큰 그룹 개수");
+        Rejects(Body({ 0x31, 0x02 }) + String("a") + Body({ 1, 0, 0, 0, 0, 0, 0, 0 }), C, "그룹 개수보다 적은 그룹");
+        Rejects(Body({ 0x31, 0x01 }) + String("a") + Body({ 1, 0, 0, 0 }), C, "잘린 그룹");
+        Rejects(Body({ 0x31, 0x01 }) + String("a|b") + Body({ 1, 0, 0, 0, 0, 0, 0, 0 }), C, "'|'가 든 그룹 s 필드");
+
+        // ? 표시
+        Rejects(Body({ 0x5A, 3, 0, 0, 0 }), C, "? 표시 없음");
+        Rejects(Body({ 0x5A, 3, 0, 0, 0, 2 }) + String("SUSPENDED"), C, "0/1이 아닌 ? 표시");
+        Rejects(Body({ 0x5A, 3, 0, 0, 0, 1 }), C, "? 표시 뒤 필드 없음");
+    }
+
+    void CheckFrameHeaders() {
+        size_t headerBytes = 0;
+        size_t bodyLength = 0;
+        auto header = [&](std::initializer_list<int> bytes, size_t maxBody) {
+            std::string data = Body(bytes);
+            return BinaryCodec::ReadHeader(data.data(), data.size(), maxBody, headerBytes, bodyLength);
+        };
+
+        Check(header({}, MAX_BODY) == FrameStatus::INCOMPLETE, "빈 헤더는 INCOMPLETE");
+        Check(header({ 0x80 }, MAX_BODY) == FrameStatus::INCOMPLETE, "잘린 헤더 varint는 INCOMPLETE");
+        Check(header({ 0x80, 0x80, 0x80, 0x80, 0x80 }, MAX_BODY) == FrameStatus::MALFORMED, "5바이트를 넘는 헤더는 MALFORMED");
+        Check(header({ 0x00 }, MAX_BODY) == FrameStatus::MALFORMED, "본문 길이 0은 MALFORMED");
+        Check(header({ 0x81, 0x40 }, MAX_BODY) == FrameStatus::MALFORMED, "maxBody를 넘는 본문은 MALFORMED");
+        Check(header({ 0x81, 0x01 }, MAX_BODY) == FrameStatus::OK && headerBytes == 2 && bodyLength == 129,
+              "2바이트 헤더 (129)");
+
+        // 여러 프레임을 이어 붙인 스트림을 한 바이트씩 늘려 가며 꺼냄 (TCP로 잘려 도착하는 경우)
+        std::string stream;
+        for (const std::string& text : CLIENT_BOUND) BinaryCodec::Encode(text, Direction::TO_CLIENT, stream);
+
+        size_t consumed = 0;
+        size_t extracted = 0;
+        bool ok = true;
+        for (size_t available = 1; available <= stream.size() && ok; ++available) {
+            const char* data = stream.data() + consumed;
+            size_t length = available - consumed;
+            std::string_view body;
+            FrameStatus status = BinaryCodec::ExtractFrame(data, length, MAX_BODY, body);
+            if (status == FrameStatus::INCOMPLETE) {
+                ok = (data == stream.data() + consumed && length == available - consumed);
+                continue;
+            }
+
+            std::string decoded;
+            ok = status == FrameStatus::OK && BinaryCodec::Decode(body, Direction::TO_CLIENT, decoded) &&
+                 decoded == CLIENT_BOUND[extracted];
+            consumed = static_cast<size_t>(data - stream.data());
+            ++extracted;
+        }
+        Check(ok && extracted == CLIENT_BOUND.size() && consumed == stream.size(),
+              "잘려 도착한 스트림에서 프레임 " + std::to_string(extracted) + "/" + std::to_string(CLIENT_BOUND.size()) + "개 복원");
+    }
+}
+
+int main() {
+    CheckRoundTrips();
+    CheckMalformedBodies();
+    CheckFrameHeaders();
+
+    std::cout << "checks: " << g_checks << ", failures: " << g_failures << std::endl;
+    return g_failures == 0 ? 0 : 1;
+}
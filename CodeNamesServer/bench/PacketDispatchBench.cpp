@@ -0,0 +1,99 @@
+// 패킷 이름 -> 핸들러 찾기 비교 (PacketOpcode.h 도입 전후)
+//  - find chain : data.find(std::string(PKT_X) + "|") == 0 if/else (처음 버전의 서버 핸들러)
+//  - match chain: Packet::MatchType if/else (string_view, 할당 없음)
+//  - map        : unordered_map<std::string, std::function> + substr 키 (처음 버전의 클라이언트 PacketHandler)
+//  - opcode     : PacketOpcode::LookupCommand (현재 - 찾은 opcode로 함수 포인터 표를 바로 인덱싱)
+// 핸들러 호출 비용은 빼고 패킷 이름 -> 핸들러 결정까지만 잼 (map은 std::function 호출 포함)
+// 빌드: cmake -DCODENAMES_BUILD_BENCH=ON, 실행: PacketDispatchBench [반복 횟수]
+#include "PacketOpcode.h"
+
+#include <chrono>
+#include <cstdlib>
+#include <functional>
+#include <iostream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace {
+    volatile int g_sink = 0;
+
+    // 서버가 받는 명령 + 클라이언트가 받는 응답을 섞은 말뭉치 (게임 중 패킷 비중이 큼)
+    const std::vector<std::string> CORPUS = {
+        "CHECK_ID|alice", "SIGNUP|alice|pw|Alice", "LOGIN|alice|pw", "TOKEN|0123456789abcdef",
+        "EDIT_NICK|0123456789abcdef|Bob", "CMD|QUERY_WAIT|0123456789abcdef",
+        "SESSION_READY|0123456789abcdef", "MATCHING_CANCEL|0123456789abcdef",
+        "HINT|animal|2", "ANSWER|tiger", "CHAT|hello everyone", "ANSWER|lion", "CHAT|gg",
+        "LOGIN_OK|0123456789abcdef", "TOKEN_VALID|Alice", "WAIT_REPLY|3|4", "GAME_START|1700000000000",
+        "TURN_UPDATE|0|1|3|2", "CARD_UPDATE|7|1", "HINT|0|animal|2", "CHAT|0|1|Alice|hello",
+        "ANSWER_RESULT|CORRECT|tiger", "GAME_OVER|RED", "UNKNOWN_PACKET|x",
+    };
+
+    int FindChain(const std::string& data) {
+        if (data.find(std::string(PKT_CHECK_ID) + "|") == 0) return 1;
+        else if (data.find(std::string(PKT_SIGNUP) + "|") == 0) return 2;
+        else if (data.find(std::string(PKT_LOGIN) + "|") == 0) return 3;
+        else if (data.find(std::string(PKT_TOKEN) + "|") == 0) return 4;
+        else if (data.find(std::string(PKT_EDIT_NICK) + "|") == 0) return 5;
+        else if (data.find(std::string(PKT_CMD_QUERY_WAIT) + "|") == 0) return 6;
+        else if (data.find(std::string(PKT_SESSION_READY) + "|") == 0) return 7;
+        else if (data.find(std::string(PKT_MATCHING_CANCEL) + "|") == 0) return 8;
+        else if (data.find(std::string(PKT_HINT_MSG) + "|") == 0) return 9;
+        else if (data.find(std::string(PKT_ANSWER) + "|") == 0) return 10;
+        else if (data.find(std::string(PKT_CHAT) + "|") == 0) return 11;
+        return 0;
+    }
+
+    int MatchChain(std::string_view data) {
+        std::string_view fields;
+        if (Packet::MatchType(data, PKT_CHECK_ID, fields)) return 1;
+        else if (Packet::MatchType(data, PKT_SIGNUP, fields)) return 2;
+        else if (Packet::MatchType(data, PKT_LOGIN, fields)) return 3;
+        else if (Packet::MatchType(data, PKT_TOKEN, fields)) return 4;
+        else if (Packet::MatchType(data, PKT_EDIT_NICK, fields)) return 5;
+        else if (Packet::MatchType(data, PKT_CMD_QUERY_WAIT, fields)) return 6;
+        else if (Packet::MatchType(data, PKT_SESSION_READY, fields)) return 7;
+        else if (Packet::MatchType(data, PKT_MATCHING_CANCEL, fields)) return 8;
+        else if (Packet::MatchType(data, PKT_HINT_MSG, fields)) return 9;
+        else if (Packet::MatchType(data, PKT_ANSWER, fields)) return 10;
+        else if (Packet::MatchType(data, PKT_CHAT, fields)) return 11;
+        return 0;
+    }
+
+    int OnPacket(const std::string& data) { return static_cast<int>(data.size() & 1); }
+
+    template<typename Dispatch>
+    void Run(const char* name, size_t iterations, Dispatch dispatch) {
+        auto start = std::chrono::steady_clock::now();
+        for (size_t i = 0; i < iterations; ++i) {
+            for (const std::string& packet : CORPUS) {
+                g_sink = g_sink + dispatch(packet);
+            }
+        }
+        auto elapsed = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+        std::cout << name << ": " << elapsed / (static_cast<double>(iterations) * CORPUS.size()) << " ns/packet" << std::endl;
+    }
+}
+
+int main(int argc, char* argv[]) {
+    size_t iterations = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 200000;
+
+    std::unordered_map<std::string, std::function<int(const std::string&)>> map;
+    for (size_t i = 1; i < PacketOpcode::COUNT; ++i) {
+        map[std::string(PacketOpcode::FirstToken(PacketOpcode::NAMES[i]))] = OnPacket;
+    }
+
+    std::cout << "packets: " << CORPUS.size() << ", iterations: " << iterations << std::endl;
+
+    Run("find chain ", iterations, FindChain);
+    Run("match chain", iterations, [](const std::string& data) { return MatchChain(data); });
+    Run("map        ", iterations, [&map](const std::string& data) {
+        auto it = map.find(data.substr(0, data.find('|')));
+        return it == map.end() ? 0 : it->second(data);
+    });
+    Run("opcode     ", iterations, [](const std::string& data) {
+        std::string_view fields;
+        return static_cast<int>(PacketOpcode::LookupCommand(data, fields));
+    });
+    return 0;
+}
@@ -0,0 +1,40 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+// 바이너리 프로토콜 코덱 (텍스트 "TYPE|f1|f2|...\n"와 1:1 변환)
+// 프레임: [varint 본문 길이][opcode 1바이트][필드...]
+//  - 문자열: varint 길이 + 바이트 / 정수: int32 리틀엔디언 (GAME_START 타임스탬프만 int64)
+//  - 반복 그룹 (GAME_INIT, ALL_CARDS): varint 개수 + 그룹들
+//  - 표에 없는 메시지나 스키마에 맞지 않는 필드는 OP_RAW로 텍스트 그대로 실음 (어떤 메시지든 손실 없음)
+// 연결마다 협상: 클라이언트가 텍스트로 PROTO|BIN1을 보내고 PROTO_OK|BIN1을 받으면 양방향 모두 바이너리
+// (서버 / 클라이언트 로직은 계속 텍스트를 다루고, 변환은 세션 송수신 경계에서만 함)
+// 클라이언트 include/core/BinaryCodec.h와 opcode 표가 같아야 함
+namespace BinaryCodec {
+    constexpr uint8_t OP_RAW = 0x00;        // 본문 = 텍스트 메시지 그대로 (구분자 제외)
+    constexpr size_t MAX_VARINT_BYTES = 5;  // uint32
+
+    // 같은 이름이라도 방향마다 필드가 다른 메시지가 있음 (HINT, CHAT)
+    enum class Direction { TO_CLIENT, TO_SERVER };
+
+    enum class FrameStatus { OK, INCOMPLETE, MALFORMED };
+
+    // 텍스트 메시지 하나(구분자 제외)를 프레임으로 만들어 out 뒤에 붙임
+    void Encode(std::string_view text, Direction direction, std::string& out);
+
+    // 프레임 본문(opcode부터)을 텍스트 메시지로 복원해 out에 담음 (잘못된 본문이면 false)
+    bool Decode(std::string_view body, Direction direction, std::string& out);
+
+    // 프레임 헤더(본문 길이)만 읽음 - 본문 길이가 0이거나 maxBody를 넘으면 MALFORMED
+    FrameStatus ReadHeader(const char* data, size_t length, size_t maxBody,
+                           size_t& headerBytes, size_t& bodyLength);
+
+    // data에서 완성된 프레임 하나를 꺼내 body에 담고 data/length를 다음 프레임으로 전진
+    // (INCOMPLETE / MALFORMED면 data/length는 그대로)
+    FrameStatus ExtractFrame(const char*& data, size_t& length, size_t maxBody, std::string_view& body);
+
+    void WriteVarint(uint32_t value, std::string& out);
+}
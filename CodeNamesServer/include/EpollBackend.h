@@ -0,0 +1,67 @@
+#pragma once
+
+#ifdef __linux__
+
+#include "IOBackend.h"
+#include <deque>
+#include <mutex>
+#include <unordered_map>
+
+// Linux edge-triggered epoll 리액터 위에 IOCP와 같은 완료 모델을 흉내내는 백엔드
+// - 소켓은 EPOLLET | EPOLLONESHOT으로 등록, 한 시점에 한 워커만 같은 소켓 이벤트를 처리
+// - PostRecv는 대기 중인 OverlappedEx를 걸어두고 재무장(MOD), 읽기 가능해지면 워커가 recv 후 완료 전달
+//   (버퍼 없는 OverlappedEx면 읽기 직전에 풀에서 버퍼를 붙임 - 유휴 소켓은 수신 버퍼를 갖지 않음)
+// - PostSend는 먼저 바로 send를 시도하고, 다 못 보낸 경우에만 EPOLLOUT을 기다린다
+// - PostAccept는 리슨 소켓에 걸어두고, 읽기 가능해지면 걸린 개수만큼 accept4를 한 번에 처리
+class EpollBackend : public IOBackend {
+public:
+    EpollBackend();
+    ~EpollBackend() override;
+
+    bool Create() override;
+    bool Associate(SOCKET socket, SessionHandle session) override;
+    void Dissociate(SOCKET socket) override;
+
+    bool PostRecv(SOCKET socket, OverlappedEx* overlapped) override;
+    bool PostSend(SOCKET socket, OverlappedEx* overlapped) override;
+    bool PostAccept(SOCKET listenSocket, OverlappedEx* overlapped) override;
+
+    bool GetCompletions(IOCompletion* completions, int maxCount, int& count, bool wait = true) override;
+    void PostShutdown(int workerCount) override;
+    void Wakeup() override;
+
+    const char* GetName() const override { return "epoll"; }
+
+private:
+    // 소켓별 대기 중인 I/O 상태
+    struct SocketContext {
+        SOCKET socket = INVALID_SOCKET;
+        SessionHandle session;
+        std::mutex lock;
+        OverlappedEx* pendingRecv = nullptr;     // 읽기 가능 시 채울 버퍼
+        std::deque<OverlappedEx*> pendingSends;  // 아직 다 보내지 못한 송신 (앞쪽부터 순서대로)
+        size_t sendOffset = 0;                   // pendingSends.front()에서 이미 보낸 바이트
+        std::deque<OverlappedEx*> pendingAccepts; // 리슨 소켓 전용
+    };
+
+    std::shared_ptr<SocketContext> FindContext(SOCKET socket);
+    bool Rearm(SocketContext& context); // context.lock 보유 상태에서 호출
+    void HandleSocketEvent(SOCKET socket, uint32_t events, std::deque<IOCompletion>& completed);
+    bool FlushSends(SocketContext& context, std::deque<IOCompletion>& completed);
+    void AcceptPending(SocketContext& context, std::deque<IOCompletion>& completed);
+    void PushCompletions(std::deque<IOCompletion>& completed, size_t callerTakes = 0);
+    int PopCompletions(IOCompletion* completions, int maxCount);
+
+    int epollFd_;
+    int wakeupFd_;    // 완료 큐에 항목이 추가되었음을 알리는 eventfd
+    int shutdownFd_;  // 종료 신호용 eventfd (level-triggered, 모든 워커가 깨어남)
+    int notifyFd_;    // Wakeup 통지용 eventfd (읽은 워커가 빈 완료를 반환)
+
+    std::mutex contextsMutex_;
+    std::unordered_map<SOCKET, std::shared_ptr<SocketContext>> contexts_;
+
+    std::mutex completionMutex_;
+    std::deque<IOCompletion> completions_;
+};
+
+#endif // __linux__
@@ -1,10 +1,13 @@
 #pragma once
 
 #include "Session.h"
+#include "SessionSlotMap.h"
 #include "DatabaseManager.h"
+#include "PacketFields.h"
 #include <vector>
 #include <unordered_map>
 #include <string>
+#include <string_view>
 #include <mutex>
 #include <memory>
 #include <random>
@@ -38,16 +41,13 @@ struct GamePlayer {
     int roleNum;          // 0~5 (플레이어 인덱스)
     Team team;            // RED(0) or BLUE(1)
     PlayerRole role;      // AGENT(0) or SPYMASTER(1)  
-    class Session* session;  // 모든 정보는 Session에서 가져옴
-
-    std::string GetNickname() const { 
-        static const std::string empty = "";
-        return session ? session->GetNickname() : empty; 
-    }
-    std::string GetToken() const { 
-        static const std::string empty = "";
-        return session ? session->GetToken() : empty; 
-    }
+    SessionHandle session;   // 세션은 핸들로만 참조 (연결이 끊겨 제거되면 조회 실패)
+    std::string nickname;    // 입장 시점의 닉네임/토큰 (세션 없이도 결과 저장 등에 사용)
+    std::string token;
+
+    bool IsOccupied() const { return session.IsValid(); }
+    const std::string& GetNickname() const { return nickname; }
+    std::string GetToken() const { return token; }
 };
 
 // 게임 카드 구조체
@@ -80,6 +80,21 @@ public:
     static constexpr int NEUTRAL_CARDS = 7; // 중립 카드 수
     static constexpr int ASSASSIN_CARDS = 1; // 암살자 카드 수
 
+    // 게임 액션 하나(패킷 처리 / 게임 시작)에서 나오는 메시지를 받는 사람별로 모았다가
+    // 범위가 끝날 때 플레이어마다 한 번에 넘김 (CARD_UPDATE + CHAT + TURN_UPDATE -> 송신 1번)
+    // 범위 동안 gameMutex_를 잡고 있음, 중첩 가능 (가장 바깥 범위가 끝날 때 송신)
+    class OutboundBatch {
+    public:
+        explicit OutboundBatch(GameManager& game);
+        ~OutboundBatch();
+        OutboundBatch(const OutboundBatch&) = delete;
+        OutboundBatch& operator=(const OutboundBatch&) = delete;
+
+    private:
+        GameManager& game_;
+        std::lock_guard<std::recursive_mutex> lock_;
+    };
+
 private:
     std::string roomId_;
     std::array<GamePlayer, MAX_PLAYERS> players_;
@@ -97,10 +112,16 @@ private:
     int hintCount_;
     bool gameOver_;
 
+    int shardIndex_; // 게임 패킷을 처리하는 소유 샤드 (샤드 모드가 아니면 0)
+    SessionSlotMap* sessions_; // 플레이어 핸들 조회용 (소유권 없음)
+
     std::recursive_mutex gameMutex_;
 
+    int outboundDepth_; // 열려 있는 OutboundBatch 수 (gameMutex_ 보호)
+    std::array<OutboundFrames, MAX_PLAYERS> pendingSends_; // 플레이어별로 모아 둔 메시지 (gameMutex_ 보호)
+
 public:
-    GameManager(const std::string& roomId);
+    GameManager(const std::string& roomId, SessionSlotMap* sessions);
     ~GameManager();
 
     // 플레이어 관리
@@ -109,6 +130,7 @@ public:
     GamePlayer* GetPlayer(const std::string& nickname);
     GamePlayer* GetPlayerByIndex(int index);
     size_t GetPlayerCount() const;
+    bool IsFinished(); // 승패가 났거나 연결된 플레이어가 없음 (다른 스레드에서 호출 가능)
 
     // 게임 초기화
     bool StartGame();
@@ -120,9 +142,14 @@ public:
     void SendAllCardsToAll();
 
     // 게임 로직
-    bool ProcessHint(int playerIndex, const std::string& word, int number);
-    bool ProcessAnswer(int playerIndex, const std::string& word);
-    bool ProcessChat(int playerIndex, const std::string& message);
+    bool ProcessHint(int playerIndex, std::string_view word, int number);
+    bool ProcessAnswer(int playerIndex, std::string_view word);
+    bool ProcessChat(int playerIndex, std::string_view message);
+    // HandleGamePacket의 opcode 표에 들어가는 핸들러 (fields는 이름 뒤를 한 번에 나눈 필드들)
+    using PacketHandler = bool (GameManager::*)(int playerIndex, const Packet::Fields& fields);
+    bool HandleHintPacket(int playerIndex, const Packet::Fields& fields);   // 단어|숫자
+    bool HandleAnswerPacket(int playerIndex, const Packet::Fields& fields); // 단어
+    bool HandleChatPacket(int playerIndex, const Packet::Fields& fields);   // 메시지 ('|' 포함 가능)
     void SendCardUpdate(int cardIndex);
 
     // 턴 관리
@@ -139,17 +166,25 @@ public:
     void SendGameState();
 
     // 게임 패킷 처리
-    void HandleGamePacket(class Session* session, const std::string& data);
+    void HandleGamePacket(class Session* session, std::string_view data);
 
     // 게임 상태 조회
     Team GetCurrentTurn() const { return currentTurn_; }
     GamePhase GetCurrentPhase() const { return currentPhase_; }
     const std::string& GetRoomId() const { return roomId_; }
+    int GetShardIndex() const { return shardIndex_; }
+    void SetShardIndex(int index) { shardIndex_ = index; }
 
 private:
+    // 플레이어 세션 조회 (빈 슬롯이거나 이미 제거된 세션이면 nullptr) - 워커 스레드에서 호출
+    Session* GetPlayerSession(int index) const;
+    // 플레이어 1명에게 송신 (OutboundBatch 범위 안이면 모아 두었다가 범위가 끝날 때 보냄)
+    void SendToPlayer(int index, const SharedPayload& payload, SendPriority priority);
+    void FlushOutbound();
     int FindPlayerIndex(const std::string& nickname);
     bool IsValidPlayerForHint(int playerIndex);    
     bool IsValidPlayerForAnswer(int playerIndex);
     void UpdateScores(CardType cardType);
     std::string CreateGameInitMessage();
+    std::string CreateAllCardsMessage();
 };
\ No newline at end of file
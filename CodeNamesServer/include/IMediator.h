@@ -12,7 +12,9 @@ public:
     
     // 세션 관리
     virtual bool AddSession(std::shared_ptr<Session> session) = 0;
-    virtual void RemoveSession(SOCKET socket) = 0;
+    virtual void RemoveSession(SessionHandle handle) = 0;
+    virtual class SessionSlotMap* GetSessionSlots() = 0; // 핸들 -> 세션 조회 (워커 완료 처리, GameManager)
+    virtual size_t GetSessionCount() const = 0;           // 현재 연결 수 (수락 제어용)
     
     // 게임 관리
     virtual void CreateGameRoom(const std::vector<std::shared_ptr<Session>>& players) = 0;
@@ -0,0 +1,73 @@
+#pragma once
+
+#include "Platform.h"
+#include "SessionHandle.h"
+#include <memory>
+#include <string>
+#ifndef _WIN32
+#include <sys/uio.h>
+#endif
+
+class Session;
+struct OverlappedEx;
+
+// 완료 통지 1건 (GetQueuedCompletionStatus 결과와 동일한 정보)
+struct IOCompletion {
+    bool success = false;            // I/O 성공 여부 (false면 세션 종료 처리)
+    DWORD bytesTransferred = 0;      // 전송된 바이트 수
+    SessionHandle session;           // CompletionKey (세션 핸들, 이미 제거된 세션이면 조회 실패)
+    OverlappedEx* overlapped = nullptr;
+};
+
+enum class IOBackendType {
+    IOCP,   // Windows I/O Completion Port
+    EPOLL,  // Linux edge-triggered epoll (완료 모델로 변환)
+    IO_URING // Linux io_uring (multishot recv + provided buffers)
+};
+
+// NetworkManager가 사용하는 완료 기반 I/O 백엔드 인터페이스
+// - PostRecv/PostSend로 요청한 작업은 반드시 GetCompletions로 완료가 전달된다 (즉시 실패한 경우 제외)
+// - 즉시 실패(false 반환)한 경우 OverlappedEx 소유권은 호출자에게 남는다
+class IOBackend {
+public:
+    static constexpr int MAX_COMPLETION_BATCH = 64; // GetCompletions 한 번에 가져오는 최대 완료 수
+
+    virtual ~IOBackend() = default;
+
+    virtual bool Create() = 0;
+    virtual bool Associate(SOCKET socket, SessionHandle session) = 0;
+    virtual void Dissociate(SOCKET socket) { (void)socket; }
+
+    virtual bool PostRecv(SOCKET socket, OverlappedEx* overlapped) = 0;
+    virtual bool PostSend(SOCKET socket, OverlappedEx* overlapped) = 0;
+
+    // 비동기 accept 요청 (리슨 소켓은 먼저 Associate(listenSocket, {})로 등록)
+    // 완료는 session 없이 operation == ACCEPT로 전달되며 overlapped->acceptSocket에 새 소켓이 담긴다
+    virtual bool PostAccept(SOCKET listenSocket, OverlappedEx* overlapped) = 0;
+
+    // 완료를 대기해서 최대 maxCount개(MAX_COMPLETION_BATCH 이하)까지 한 번에 가져옴, 종료 신호를 받으면 false
+    // (IOCP: GetQueuedCompletionStatusEx, epoll: epoll_wait 여러 이벤트, io_uring: 도착한 CQE 전부)
+    // Wakeup으로 깨어난 경우 count가 0일 수 있음
+    // wait == false: 대기하지 않고 지금 도착한 완료만 가져옴 (없으면 count 0 - 바쁜 대기 모드)
+    virtual bool GetCompletions(IOCompletion* completions, int maxCount, int& count, bool wait = true) = 0;
+
+    // 대기 중인 워커 스레드들을 깨워 종료시킴
+    virtual void PostShutdown(int workerCount) = 0;
+
+    // 대기 중인 워커 하나를 깨움 - GetCompletions가 바로 반환 (샤드 메일박스 확인용)
+    virtual void Wakeup() = 0;
+
+    virtual const char* GetName() const = 0;
+
+    // 현재 플랫폼 기본 백엔드 생성 (Windows: IOCP, Linux: epoll)
+    static IOBackendType DefaultType();
+    // "iocp" / "epoll" / "io_uring" 문자열을 타입으로 변환 (알 수 없으면 false)
+    static bool ParseType(const std::string& name, IOBackendType& type);
+    static std::unique_ptr<IOBackend> CreateBackend(IOBackendType type);
+
+protected:
+#ifndef _WIN32
+    // 송신 버퍼 목록(WSABUF)에서 앞쪽 offset 바이트를 건너뛴 나머지를 iovec으로 변환, 개수 반환
+    static size_t BuildSendIovec(OverlappedEx* overlapped, size_t offset, iovec* iov);
+#endif
+};
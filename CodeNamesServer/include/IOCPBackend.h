@@ -0,0 +1,44 @@
+#pragma once
+
+#ifdef _WIN32
+
+#include "IOBackend.h"
+#include <mswsock.h>
+
+// 기존 NetworkManager의 IOCP 루프를 그대로 옮긴 백엔드
+// - accept는 AcceptEx를 미리 걸어두고 완료 시 주소를 정리해 다른 백엔드와 같은 형태로 전달
+// - 버퍼 없는 수신은 0바이트 WSARecv로 걸어두고, 완료(데이터 도착)되면 풀에서 버퍼를 붙여 논블로킹 recv로 읽음
+class IOCPBackend : public IOBackend {
+public:
+    IOCPBackend();
+    ~IOCPBackend() override;
+
+    bool Create() override;
+    bool Associate(SOCKET socket, SessionHandle session) override;
+
+    bool PostRecv(SOCKET socket, OverlappedEx* overlapped) override;
+    bool PostSend(SOCKET socket, OverlappedEx* overlapped) override;
+    bool PostAccept(SOCKET listenSocket, OverlappedEx* overlapped) override;
+
+    bool GetCompletions(IOCompletion* completions, int maxCount, int& count, bool wait = true) override;
+    void PostShutdown(int workerCount) override;
+    void Wakeup() override;
+
+    const char* GetName() const override { return "iocp"; }
+
+    // AcceptEx 주소 영역 크기 (주소 구조체 + 16바이트, 로컬/원격 각각)
+    static constexpr DWORD ACCEPT_ADDRESS_SIZE = sizeof(sockaddr_in) + 16;
+    // Wakeup 통지용 CompletionKey (세션 핸들 키는 세대가 1 이상이라 2^32 이상, 종료 신호는 0)
+    static constexpr ULONG_PTR WAKEUP_KEY = 1;
+
+private:
+    bool LoadAcceptExtensions(SOCKET listenSocket);
+    void CompleteAccept(OverlappedEx* overlapped);
+    bool ReadOnDemand(IOCompletion& completion); // 읽을 데이터가 없어 수신을 다시 걸었으면 false
+
+    HANDLE iocpHandle_;
+    LPFN_ACCEPTEX acceptEx_;                         // WSAIoctl로 얻는 확장 함수
+    LPFN_GETACCEPTEXSOCKADDRS getAcceptExSockaddrs_;
+};
+
+#endif // _WIN32
@@ -1,9 +1,6 @@
 #pragma once
 
-#define WIN32_LEAN_AND_MEAN
-#include <winsock2.h>
-#include <ws2tcpip.h>
-#include <Windows.h>
+#include "Platform.h"
 #include <memory>
 #include <vector>
 #include <thread>
@@ -11,21 +8,45 @@
 #include <atomic>
 #include <iostream>
 #include <unordered_map>
+#include <functional>
+#include <condition_variable>
+#include <string>
 
 #include "IMediator.h"
+#include "IOBackend.h"
 
 class IOCPServer : public IMediator {
 public:
     static constexpr int BUFFER_SIZE = 256;
-    static constexpr int MAX_CLIENTS = 64;
+    static constexpr int MAX_CLIENTS = 20000;        // 기본 최대 동시 연결 수 (넘으면 새 연결은 바로 닫음)
+    static constexpr int SESSION_POOL_SIZE = 1024;   // 기본으로 미리 만들어 두는 Session 수
+    static constexpr int SOFT_CLIENTS_PERCENT = 90;  // 기본 소프트 상한 (넘으면 SERVER_BUSY 응답 후 닫음)
     static constexpr int TOKEN_LEN = 64;    
     static constexpr int SERVER_PORT = 55014;
     static constexpr int TCP_PORT = 55015;
+    static constexpr int DRAIN_CHECK_MS = 1000; // 인계 후 진행 중인 게임이 끝났는지 확인하는 주기
 
 public:
-    IOCPServer(int port = SERVER_PORT);
+    // shardCount > 0 이면 샤드 모드, completionBatch는 워커가 한 번에 가져오는 완료 수 (NetworkManager 참고)
+    IOCPServer(int port = SERVER_PORT, IOBackendType backendType = IOBackend::DefaultType(), int shardCount = 0,
+               int completionBatch = IOBackend::MAX_COMPLETION_BATCH);
     ~IOCPServer();
 
+    // 연결 수 상한 (Initialize 전에 호출, softLimit 0이면 hardLimit의 SOFT_CLIENTS_PERCENT%)
+    void SetConnectionLimits(int hardLimit, int softLimit);
+    // 워커 바쁜 대기 시간 (Initialize 전에 호출, 0이면 끔 - NetworkManager::SetBusyPoll 참고)
+    void SetBusyPoll(int pollUs) { busyPollUs_ = pollUs; }
+    // 같은 호스트 클라이언트용 Unix 도메인 소켓 경로 (Start 전에 호출, 빈 문자열이면 TCP만)
+    void SetUnixSocketPath(const std::string& path) { unixSocketPath_ = path; }
+    // 미리 만들어 둘 Session 수 (Initialize 전에 호출, 0이면 풀 없음 - SessionPool 참고)
+    void SetSessionPoolSize(int size) { sessionPoolSize_ = size; }
+
+    // 무중단 재시작 (Initialize 전에 호출) - path에 이전 프로세스가 있으면 리슨 소켓을 넘겨받고,
+    // 이후 같은 path로 다음 프로세스에 넘겨줌. 넘겨준 뒤에는 새 게임을 만들지 않고 진행 중인 게임이 모두 끝나면
+    // onDrained 호출 (드레인 스레드에서 호출, 프로세스 종료는 호출자가 처리)
+    void SetHandoffPath(const std::string& path) { handoffPath_ = path; }
+    void SetDrainedHandler(std::function<void()> onDrained) { onDrained_ = std::move(onDrained); }
+
     bool Initialize();
     void Start();
     void Stop();
@@ -33,16 +54,38 @@ public:
 private:
     bool isRunning;
     int port;
+    IOBackendType backendType_;
+    int shardCount_;
+    int completionBatch_;
+    int maxClients_;
+    int softClients_;
+    int busyPollUs_;
+    std::string unixSocketPath_;
+    int sessionPoolSize_;
     
     std::unique_ptr<class NetworkManager> networkManager_;
     std::unique_ptr<class SessionManager> sessionManager_;
 
+    std::string handoffPath_;
+    std::unique_ptr<class ListenerHandoff> handoff_;
+    std::function<void()> onDrained_;
+    bool draining_;  // 리슨 소켓을 넘겨준 뒤 true (gamesMutex_ 보호)
+    bool drainStop_; // gamesMutex_ 보호
+    std::atomic<uint32_t> roomSequence_; // 같은 초에 만든 게임방끼리 이름이 겹치지 않도록
+    std::thread drainThread_;
+    std::condition_variable drainCv_;
+
+    void BeginDrain();  // 수락 / 매칭 중단 + 드레인 스레드 시작
+    void DrainThread(); // 진행 중인 게임이 모두 끝나면 onDrained_ 호출
+
     // 복사 방지
     IOCPServer(const IOCPServer&) = delete;
     IOCPServer& operator=(const IOCPServer&) = delete;
 
 public:
-    void RemoveSession(SOCKET socket);
+    void RemoveSession(SessionHandle handle);
+    SessionSlotMap* GetSessionSlots();
+    size_t GetSessionCount() const;
     bool AddSession(std::shared_ptr<class Session> session);
     
     // 매니저 접근자들 (DatabaseManager는 싱글톤으로 직접 접근)
@@ -53,6 +96,9 @@ public:
     void RemoveGameRoom(const std::string& roomId);
 
 private:
+    // 게임방 생성 (게임방 소유 샤드의 워커에서 실행)
+    void BuildGameRoom(const std::vector<std::shared_ptr<class Session>>& players, int shardIndex);
+
     std::unordered_map<std::string, std::unique_ptr<class GameManager>> activeGames_;
     std::mutex gamesMutex_;  // activeGames_ 보호용
 }; 
\ No newline at end of file
@@ -0,0 +1,40 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+enum class IOOperation;
+struct OverlappedEx;
+
+// OverlappedEx(I/O 컨텍스트) 재사용 풀
+// - 버퍼 크기별 3단계 클래스: SMALL(송신), LARGE(수신), 버퍼 없음(데이터 도착 전까지 걸어두는 수신)
+// - 스레드마다 free list를 두고 락 없이 꺼내/반납, 넘치면 전역 free list로 이동
+//   (수신 완료를 처리한 워커와 다음 수신을 요청하는 스레드가 달라도 컨텍스트가 순환됨)
+// - 재사용 시 OVERLAPPED 헤더만 초기화하고 버퍼는 0으로 채우지 않음
+class IoContextPool {
+public:
+    static constexpr size_t SMALL_BUFFER_SIZE = 512;
+    static constexpr size_t LARGE_BUFFER_SIZE = 4096;
+    static constexpr size_t THREAD_CACHE_LIMIT = 256;   // 클래스별 스레드 캐시 상한
+    static constexpr size_t GLOBAL_BATCH = 32;          // 전역 리스트와 한 번에 주고받는 개수
+
+    // bufferSize 이상을 담을 수 있는 가장 작은 클래스의 컨텍스트 반환 (0이면 버퍼 없는 컨텍스트)
+    static OverlappedEx* Acquire(IOOperation operation, size_t bufferSize);
+    static void Release(OverlappedEx* overlapped);
+
+    // 버퍼가 bufferSize보다 작은 컨텍스트를 같은 작업의 버퍼 있는 컨텍스트로 교체 (원래 것은 반납)
+    // 이미 충분하면 그대로 반환, 실패하면 nullptr (원래 컨텍스트는 그대로 유효)
+    static OverlappedEx* AttachBuffer(OverlappedEx* overlapped, size_t bufferSize);
+
+    // 통계 (힙 할당 횟수 / 풀 재사용 횟수)
+    static uint64_t GetHeapAllocCount() { return heapAllocCount_.load(std::memory_order_relaxed); }
+    static uint64_t GetReuseCount() { return reuseCount_.load(std::memory_order_relaxed); }
+    // 사용 중(Acquire 후 아직 Release 안 됨)인 컨텍스트 + 버퍼 바이트
+    static int64_t GetInUseBytes() { return inUseBytes_.load(std::memory_order_relaxed); }
+
+private:
+    static std::atomic<uint64_t> heapAllocCount_;
+    static std::atomic<uint64_t> reuseCount_;
+    static std::atomic<int64_t> inUseBytes_;
+};
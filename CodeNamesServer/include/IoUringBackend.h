@@ -0,0 +1,198 @@
+#pragma once
+
+#ifdef __linux__
+
+#include "IOBackend.h"
+#include "Session.h"
+#include <atomic>
+#include <deque>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+struct io_uring_sqe;
+struct io_uring_cqe;
+
+// io_uring 프로액터 백엔드 (liburing 없이 시스템콜 직접 사용)
+// - 소켓마다 multishot recv 1개를 걸어두고, 커널이 공유 provided buffer 그룹에서 버퍼를 골라 채운다
+//   (버퍼 반납은 IORING_OP_PROVIDE_BUFFERS SQE로 - 일부 커널에서 PBUF_RING이 등록은 되지만 버퍼를 내주지 않음)
+//   Session::PostRecv가 걸어둔 OverlappedEx로는 도착한 데이터를 복사해서 완료를 전달 (완료 모델 유지)
+//   (버퍼 없이 걸린 OverlappedEx는 복사 직전에 풀에서 버퍼를 붙임 - 유휴 소켓은 수신 버퍼를 갖지 않음)
+// - 소켓은 등록된(fixed) 파일 테이블에 넣고 IOSQE_FIXED_FILE로 참조 (요청마다 fd 조회/참조 카운트 생략)
+// - 송신은 OverlappedEx 버퍼에서 바로 전송 (복사 없음, 여러 버퍼면 SENDMSG), 소켓당 1개씩 순서대로
+// - accept도 리슨 소켓마다 multishot accept 1개로 처리하고, PostAccept가 걸어둔 OverlappedEx에 하나씩 전달
+// - 워커 스레드에서 만든 SQE는 바로 제출하지 않고 다음 대기(io_uring_enter) 때 한 번에 제출
+class IoUringBackend : public IOBackend {
+public:
+    static constexpr unsigned RING_ENTRIES = 4096;
+    static constexpr unsigned RECV_BUFFER_COUNT = 1024;   // provided buffer 개수 (2의 거듭제곱)
+    static constexpr unsigned RECV_BUFFER_SIZE = 4096;
+    static constexpr size_t MAX_RECV_BACKLOG = 8;         // 소켓당 처리 대기 버퍼 상한 (초과 시 multishot 일시 중지)
+    static constexpr unsigned FIXED_FILE_COUNT = 4096;    // 등록 파일 테이블 크기 (초과 시 일반 fd 사용)
+    static constexpr size_t MAX_ACCEPT_BACKLOG = 64;      // 리슨 소켓당 전달 대기 소켓 상한 (초과 시 multishot 일시 중지)
+
+    IoUringBackend();
+    ~IoUringBackend() override;
+
+    bool Create() override;
+    bool Associate(SOCKET socket, SessionHandle session) override;
+    void Dissociate(SOCKET socket) override;
+
+    bool PostRecv(SOCKET socket, OverlappedEx* overlapped) override;
+    bool PostSend(SOCKET socket, OverlappedEx* overlapped) override;
+    bool PostAccept(SOCKET listenSocket, OverlappedEx* overlapped) override;
+
+    bool GetCompletions(IOCompletion* completions, int maxCount, int& count, bool wait = true) override;
+    void PostShutdown(int workerCount) override;
+    void Wakeup() override;
+
+    const char* GetName() const override { return "io_uring"; }
+
+private:
+    struct SocketContext;
+
+    enum class RequestKind { RECV, SEND, ACCEPT };
+
+    // SQE user_data로 넘기는 요청 (완료 시 어떤 소켓/버퍼인지 복원)
+    struct Request {
+        RequestKind kind;
+        std::shared_ptr<SocketContext> context; // 커널이 요청을 들고 있는 동안 컨텍스트 유지
+        OverlappedEx* overlapped = nullptr;     // SEND 전용
+        msghdr msg = {};                        // 모아 보내기 SENDMSG용 (완료까지 유지)
+        iovec iov[MAX_SEND_GATHER] = {};
+        size_t offset = 0;                      // 부분 전송 진행량
+    };
+
+    // multishot recv로 받았지만 아직 세션에 전달하지 않은 버퍼
+    struct RecvChunk {
+        uint16_t bufferId;
+        uint32_t length;
+        uint32_t offset;
+    };
+
+    struct SocketContext : std::enable_shared_from_this<SocketContext> {
+        IoUringBackend* backend = nullptr;
+        SOCKET socket = INVALID_SOCKET;
+        int fileIndex = -1;                   // 등록 파일 테이블 슬롯 (-1 이면 일반 fd)
+        SessionHandle session;
+        std::mutex lock;
+        bool closed = false;
+
+        OverlappedEx* postedRecv = nullptr;   // Session::PostRecv가 걸어둔 버퍼
+        Request* recvRequest = nullptr;       // 걸려있는 multishot recv
+        bool cancelRequested = false;
+        bool starved = false;                 // provided buffer 고갈로 recv가 중단됨
+        bool eof = false;
+        bool failed = false;
+        std::deque<RecvChunk> backlog;
+
+        Request* sendRequest = nullptr;       // 전송 중인 송신 (소켓당 1개)
+        std::deque<OverlappedEx*> pendingSends;
+
+        // 리슨 소켓 전용
+        Request* acceptRequest = nullptr;     // 걸려있는 multishot accept
+        bool acceptCancelRequested = false;
+        bool acceptFailed = false;            // 에러로 중단됨 (다음 PostAccept에 실패로 전달 후 재무장)
+        std::deque<OverlappedEx*> postedAccepts;
+        std::deque<SOCKET> acceptBacklog;     // 수락됐지만 아직 전달하지 않은 소켓
+
+        // 제출 대기 중인 SQE가 슬롯을 참조할 수 있으므로 컨텍스트가 사라질 때 슬롯 반납
+        ~SocketContext() {
+            if (backend) backend->ReleaseFileSlot(fileIndex);
+        }
+    };
+
+    // 링 설정/해제
+    bool SetupRing();
+    bool SetupRecvBuffers();
+    bool SetupFixedFiles();
+
+    // SQ/CQ 조작
+    io_uring_sqe* AcquireSqe(); // sqMutex_ 보유 상태에서 호출, 채운 뒤 CommitSqe
+    void CommitSqe();
+    void SetSqeFile(io_uring_sqe* sqe, const SocketContext& context);
+    void QueueRecv(SocketContext& context);
+    void QueueSend(SocketContext& context, Request* request);
+    void QueueAccept(SocketContext& context);
+    void QueueCancel(Request* target);
+    void QueueNop();
+    void SubmitIfNotWorker();
+    int SubmitAndWait(unsigned waitCount);
+    bool ReapCqe(io_uring_cqe& cqe);
+
+    void HandleCqe(const io_uring_cqe& cqe);
+    void HandleRecvCqe(SocketContext& context, Request* request, const io_uring_cqe& cqe,
+                       std::deque<IOCompletion>& completed);
+    void HandleSendCqe(SocketContext& context, Request* request, int result,
+                       std::deque<IOCompletion>& completed);
+    void HandleAcceptCqe(SocketContext& context, Request* request, const io_uring_cqe& cqe,
+                         std::deque<IOCompletion>& completed);
+    void DeliverAccepts(SocketContext& context, std::deque<IOCompletion>& completed);
+    void MaybeArmAccept(SocketContext& context);
+    void ArmDeferredAccepts();
+    void DeliverRecv(SocketContext& context, std::deque<IOCompletion>& completed);
+    void MaybeArmRecv(SocketContext& context);
+    void StartNextSend(SocketContext& context);
+
+    // 버퍼 관리
+    char* RecvBufferAddress(uint16_t bufferId) const;
+    void ReturnRecvBuffer(uint16_t bufferId); // sqMutex_ 미보유 상태에서 호출
+    void RearmStarved();
+    int AcquireFileSlot(SOCKET socket);
+    void ReleaseFileSlot(int slot);
+
+    std::shared_ptr<SocketContext> FindContext(SOCKET socket);
+    void ReleaseRequests(SocketContext& context); // 링을 닫은 뒤 커널이 돌려주지 않은 요청 해제
+    void PushCompletions(std::deque<IOCompletion>& completed);
+    int PopCompletions(IOCompletion* completions, int maxCount);
+
+    // 링 상태
+    int ringFd_;
+    void* sqRingPtr_;
+    size_t sqRingSize_;
+    void* cqRingPtr_;
+    size_t cqRingSize_;
+    io_uring_sqe* sqes_;
+    size_t sqesSize_;
+    unsigned* sqHead_;
+    unsigned* sqTail_;
+    unsigned sqMask_;
+    unsigned sqEntries_;
+    unsigned* sqArray_;
+    unsigned* cqHead_;
+    unsigned* cqTail_;
+    unsigned cqMask_;
+    io_uring_cqe* cqes_;
+
+    std::mutex sqMutex_;
+    std::mutex cqMutex_;
+    unsigned pendingSubmit_; // 큐에 넣었지만 아직 제출하지 않은 SQE 수 (sqMutex_ 보호)
+    std::atomic<bool> shuttingDown_;
+    std::atomic<bool> notified_; // Wakeup 요청 (다음 GetCompletions가 바로 반환)
+
+    // provided buffer 그룹 (multishot recv용)
+    char* recvBuffers_;
+    std::atomic<bool> recvBuffersReturned_;
+    std::mutex starvedMutex_;
+    std::vector<std::weak_ptr<SocketContext>> starved_;
+
+    // 워커가 아닌 스레드에서 요청된 accept 무장 (커널 task_work가 요청을 제출한 스레드에서 실행되므로 워커가 대신 제출)
+    std::mutex deferredAcceptMutex_;
+    std::vector<std::weak_ptr<SocketContext>> deferredAccepts_;
+
+    // 등록 파일 테이블
+    std::mutex fileSlotMutex_;
+    std::vector<int> freeFileSlots_;
+
+    std::mutex contextsMutex_;
+    std::unordered_map<SOCKET, std::shared_ptr<SocketContext>> contexts_;
+
+    // 해제됐지만 취소 완료를 아직 받지 못한 컨텍스트 (종료 직전 해제된 리슨 소켓 등, 소멸 시 정리)
+    std::mutex closingMutex_;
+    std::vector<std::weak_ptr<SocketContext>> closing_;
+
+    std::mutex completionMutex_;
+    std::deque<IOCompletion> completions_;
+};
+
+#endif // __linux__
@@ -0,0 +1,47 @@
+#pragma once
+
+#include "Platform.h"
+#include <atomic>
+#include <functional>
+#include <string>
+#include <thread>
+#include <vector>
+
+// 무중단 재시작용 리슨 소켓 인계 (Linux: Unix 도메인 소켓 + SCM_RIGHTS)
+// - 새 프로세스: Receive로 기존 프로세스에 접속해 리슨 소켓을 받아 바로 수락 시작,
+//   수락을 걸고 나면 Confirm으로 알림 -> 기존 프로세스는 그때 수락을 멈춤
+// - 기존 프로세스: Serve로 인계 요청을 기다림. 확인을 못 받으면 (새 프로세스가 시작 실패) 계속 수락
+// - 리슨 소켓은 같은 커널 소켓을 공유하므로 인계 중 들어온 연결도 대기열에 남아 잃지 않음
+// Windows는 미지원 (WSADuplicateSocket은 대상 프로세스 ID가 필요해 이 방식과 맞지 않음)
+class ListenerHandoff {
+public:
+    static constexpr int MAX_SOCKETS = 64;        // 한 번에 넘기는 리슨 소켓 최대 수
+    static constexpr int CONFIRM_TIMEOUT_SEC = 10; // 새 프로세스의 수락 시작 확인 대기 시간
+
+    // 인계할 리슨 소켓 목록을 돌려줌
+    using SocketProvider = std::function<std::vector<SOCKET>()>;
+    // 새 프로세스가 수락을 시작한 뒤 호출 (기존 프로세스는 여기서 수락 중단 + 드레인 시작)
+    using HandedOffHandler = std::function<void()>;
+
+    explicit ListenerHandoff(const std::string& path);
+    ~ListenerHandoff();
+
+    // path에서 대기 중인 기존 프로세스가 있으면 리슨 소켓을 받아옴 (없거나 실패하면 false - 새로 열면 됨)
+    bool Receive(std::vector<SOCKET>& sockets);
+    // 받은 소켓으로 수락을 시작했음을 기존 프로세스에 알림
+    void Confirm();
+
+    // path에서 다음 프로세스의 인계 요청을 기다림 (한 번 넘기면 종료)
+    bool Serve(SocketProvider provider, HandedOffHandler onHandedOff);
+    void Stop();
+
+private:
+    std::string path_;
+    SOCKET peer_;                 // Receive 후 Confirm 전까지 유지하는 기존 프로세스 연결
+    SOCKET listener_;             // Serve용 Unix 소켓
+    std::atomic<bool> serving_;
+    std::thread serveThread_;
+
+    void ServeLoop(SocketProvider provider, HandedOffHandler onHandedOff);
+    bool SendSockets(SOCKET peer, const std::vector<SOCKET>& sockets);
+};
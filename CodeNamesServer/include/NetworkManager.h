@@ -1,22 +1,51 @@
 #pragma once
-#define WIN32_LEAN_AND_MEAN
-#include <winsock2.h>
-#include <ws2tcpip.h>
-#include <Windows.h>
+#include "Platform.h"
 #include <vector>
 #include <thread>
 #include <atomic>
 #include <memory>
+#include <mutex>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <algorithm>
 
 #include "IMediator.h"
+#include "IOBackend.h"
+#include "Shard.h"
+#include "SessionPool.h"
+#include "SessionHandle.h"
 
 class Session; // Session.h를 include하지 않고 포인터만 사용
+class SessionSlotMap;
 class IOCPServer;
 class SessionManager;
 
 class NetworkManager {
     public:
-        NetworkManager(int port, IMediator* server);
+        static constexpr int STATS_INTERVAL_SEC = 5; // 처리량 로그 주기
+        static constexpr int PENDING_ACCEPT_COUNT = 16; // 미리 걸어두는 accept 수 (리슨 소켓 전체 합)
+        static constexpr size_t ACCEPT_BUFFER_SIZE = (sizeof(sockaddr_in) + 16) * 2; // AcceptEx 로컬/원격 주소 영역
+        static constexpr int64_t TIMEOUT_RECHECK_MS = 60 * 1000; // 기한이 남은 세션도 최소 이 주기로 다시 확인
+                                                                 // (상태가 바뀌어 제한 시간이 짧아진 경우 대비)
+        static constexpr int64_t SHED_LATENCY_MS = 200;  // 워커 지연이 이보다 길면 새 연결을 SERVER_BUSY로 돌려보냄
+        static constexpr int64_t SHED_RECOVER_MS = 50;   // 이 아래로 내려오면 다시 받음
+
+        // 새 연결 수락 판단 결과
+        enum class Admission {
+            ACCEPT,
+            BUSY,   // 소프트 상한 초과 또는 과부하 - SERVER_BUSY 응답 후 닫음
+            REJECT  // 최대 연결 수 초과 - 응답 없이 바로 닫음
+        };
+
+        // shardCount 0: 공유 워커 모드 (백엔드 1개를 워커 workerThreadCount_개가 함께 처리)
+        // shardCount N: 샤드 모드 (샤드마다 백엔드 1개 + CPU에 고정된 워커 1개, 세션/게임방은 한 샤드 소유)
+        // completionBatch: 워커가 한 번 깨어날 때 가져오는 최대 완료 수 (1이면 완료마다 대기)
+        // inheritedListenSockets: 이전 프로세스에서 인계받은 리슨 소켓 (있으면 새로 열지 않고 그대로 사용)
+        NetworkManager(int port, IMediator* server, IOBackendType backendType = IOBackend::DefaultType(),
+                       int shardCount = 0, int completionBatch = IOBackend::MAX_COMPLETION_BATCH,
+                       std::vector<SOCKET> inheritedListenSockets = {});
         ~NetworkManager();
 
         void SetServer(IMediator* server) { server_ = server; }
@@ -25,30 +54,115 @@ class NetworkManager {
         bool Initialize();
         void Shutdown();
 
-        bool AssociateSocketWithIOCP(SOCKET socket, Session* session);
-        void RemoveSession(SOCKET socket);
+        // 수락 제어 - 기존 연결(진행 중인 게임)의 지연을 지키기 위해 새 연결부터 거절
+        // hardLimit 이상이면 바로 닫고, softLimit 이상이거나 워커 지연이 SHED_LATENCY_MS를 넘으면 SERVER_BUSY
+        void SetConnectionLimits(int hardLimit, int softLimit);
+
+        // 바쁜 대기 (저지연 모드, Initialize 전에 호출) - 워커가 잠들기 전에 pollUs 동안 완료를 계속 확인
+        // 깨어나는 지연 대신 CPU를 씀 (샤드 모드에서 워커가 코어에 고정된 경우 권장), 0이면 바로 대기
+        // 클라이언트 소켓은 TCP_NODELAY, Linux는 SO_BUSY_POLL도 같은 값으로 설정 (NIC 큐를 직접 확인, 권한 필요할 수 있음)
+        void SetBusyPoll(int pollUs) { busyPollUs_ = std::max<int>(pollUs, 0); }
+
+        // 미리 만들어 둘 Session 수 (Initialize 전에 호출, 0이면 연결마다 새로 할당 - SessionPool 참고)
+        void SetSessionPoolSize(size_t size) { sessionPoolSize_ = size; }
+
+        bool AssociateSocket(SOCKET socket, Session* session); // session의 소유 샤드 백엔드에 핸들로 등록
+        void DissociateSocket(SOCKET socket, int shardIndex);
+        void RemoveSession(SessionHandle handle);
+
+        // Session의 비동기 I/O 요청을 소유 샤드의 백엔드로 전달
+        bool PostRecv(SOCKET socket, struct OverlappedEx* overlapped, int shardIndex);
+        bool PostSend(SOCKET socket, struct OverlappedEx* overlapped, int shardIndex);
+
+        // 샤드 간 작업 전달
+        // - IsOnShard: 현재 스레드가 해당 샤드 상태를 직접 다뤄도 되는지 (샤드가 1개면 항상 true)
+        // - RunOnShard: 그 샤드 워커면 바로 실행, 아니면 메일박스로 넘김 (워커가 아닌 스레드는 항상 넘김)
+        bool IsOnShard(int shardIndex) const {
+            return shards_.size() <= 1 || Shard::CurrentIndex() == shardIndex;
+        }
+        void RunOnShard(int shardIndex, std::function<void()> task);
 
-        SOCKET CreateListenSocket(int port);
+        // 워커가 완료 배치를 처리하는 중이면 세션의 송신 시작을 배치 끝으로 미룸 (미뤘으면 true)
+        // 배치 동안 같은 세션에 쌓인 메시지는 배치 끝에서 모아 보내기 1번으로 전송된다
+        static bool DeferSendFlush(Session* session);
+        static bool InSendBatch();
+
+        int NextShard(); // 새 세션/게임방을 배정할 샤드 (라운드 로빈)
+        int GetShardCount() const { return static_cast<int>(shards_.size()); }
+
+        SOCKET CreateListenSocket(int port, bool reusePort = false);
+        SOCKET CreateUnixListenSocket(const std::string& path); // Linux 전용 (Windows는 INVALID_SOCKET)
         bool StartAccept();
 
+        // 같은 호스트의 게이트웨이/봇용 Unix 도메인 소켓 리스너 (StartAccept 전에 호출, 빈 문자열이면 사용 안 함)
+        // TCP 루프백 스택을 거치지 않고 같은 Session 파이프라인으로 처리됨 (리슨 소켓 인계 대상은 아님 - 새 프로세스가 다시 염)
+        void SetUnixSocketPath(const std::string& path) { unixSocketPath_ = path; }
+
+        // 리슨 소켓 인계 - 다음 프로세스에 넘길 소켓 목록, 넘긴 뒤에는 이 프로세스의 수락만 멈춤
+        // (소켓은 Shutdown까지 열어둠: 커널 소켓은 새 프로세스와 공유 중이고, 번호가 재사용되지 않게 함)
+        std::vector<SOCKET> GetListenSockets() const { return listenSockets_; }
+        void StopAccepting();
+        bool IsAccepting() const { return accepting_.load(std::memory_order_relaxed); }
+
+        const char* GetBackendName() const {
+            return shards_.empty() ? "none" : shards_.front()->GetBackend()->GetName();
+        }
+
     private:
         IMediator* server_;  // IMediator 참조
+        SessionSlotMap* sessions_; // 완료의 세션 핸들 -> Session* 조회 (SessionManager 소유)
+        size_t sessionPoolSize_;
+        SessionPool sessionPool_;  // 새 연결의 Session 재사용
+
+        IOBackendType backendType_;          // 시작 시 선택한 백엔드
+        int shardCount_;                     // 0이면 공유 워커 모드
+        std::vector<std::unique_ptr<Shard>> shards_; // 샤드별 IOCP / epoll / io_uring 완료 루프
+        std::atomic<unsigned> nextShard_;
+        std::vector<SOCKET> listenSockets_; // Linux: SO_REUSEPORT로 워커(샤드) 수만큼, Windows: 1개
+        bool acceptHandoff_;                // 리슨 소켓이 샤드보다 적으면 수락한 소켓을 다른 샤드로 넘김
+        std::atomic<bool> accepting_;       // 리슨 소켓을 다음 프로세스에 넘긴 뒤 false (accept 재요청 중단)
+        std::string unixSocketPath_;
+        SOCKET unixListenSocket_;           // 수락한 연결은 샤드에 라운드 로빈으로 나눠줌
+        uint64_t unixSocketInode_;          // 바인드한 경로의 inode (종료 시 아직 이 소켓의 경로일 때만 지움)
 
-        HANDLE iocpHandle_;
-        SOCKET listenSocket_;
-        
         // 스레드 관리
-        std::vector<std::thread> workerThreads_; // IOCP에서 완료된 작업들을 처리하는 스레드
-        bool isRunning_;
+        std::vector<std::thread> workerThreads_; // 완료된 작업들을 처리하는 스레드
+        std::atomic<bool> isRunning_;
         int workerThreadCount_;
+        int completionBatch_;                // 워커가 한 번에 가져오는 완료 수
+        int busyPollUs_;                     // 0이면 바쁜 대기 없음
+
+        // 처리량 통계 (백엔드 간 비교용: connections/sec, messages/sec)
+        std::atomic<uint64_t> acceptedCount_;
+        std::atomic<uint64_t> recvCount_;
+        std::atomic<uint64_t> sendCount_;
+        std::atomic<uint64_t> busyCount_;     // SERVER_BUSY로 돌려보낸 연결 수
+        std::atomic<uint64_t> rejectedCount_; // 최대 연결 수 초과로 닫은 연결 수
 
-        std::thread acceptThread_; // Accept 전용 스레드
+        // 수락 제어
+        int maxConnections_;
+        int softConnections_;
+        std::atomic<bool> overloaded_; // 워커 지연으로 새 연결을 거절 중 (통계 스레드가 갱신)
+        std::thread statsThread_; // 통계 로그 + 타이머가 밀린 유휴 샤드 깨우기
+        std::mutex statsMutex_;
+        std::condition_variable statsCv_;
 
     private:
-        bool CreateIOCP();
-        void CreateWorkerThreads(int count);
-        void WorkerThreads();
+        std::unique_ptr<IOBackend> CreateBackend();
+        void CreateWorkerThreads(int countPerShard);
+        void WorkerThreads(Shard* shard, int pinnedCore);
+        void StopWorkerThreads();
+        bool WaitCompletions(Shard* shard, IOCompletion* completions, int& count); // 바쁜 대기 후 대기
+        void CheckTimeouts(Shard* shard, std::vector<SessionHandle>& expired);
+        void FlushSendBatch(std::vector<SessionHandle>& batch);
+        static void PinCurrentThread(int core);
         void ProcessCompletionPacket(DWORD bytesTransferred, Session* session,
                                  struct OverlappedEx* overlapped);
-        void HandleNewClient(SOCKET clientSocket, const sockaddr_in& clientAddr);
-};
\ No newline at end of file
+        bool PostAccept(SOCKET listenSocket, Shard* shard);
+        void CloseUnixListenSocket();
+        void ProcessAccept(Shard* shard, bool success, struct OverlappedEx* overlapped);
+        void HandleNewClient(SOCKET clientSocket, const sockaddr_in& clientAddr, int shardIndex);
+        Admission AdmitConnection() const;
+        void UpdateOverload(int64_t nowMs); // 샤드 지연 측정 + 과부하 상태 갱신 (통계 스레드)
+        void StatsThread();
+};
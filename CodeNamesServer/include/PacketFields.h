@@ -0,0 +1,98 @@
+#pragma once
+
+#include <charconv>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+// 패킷 필드 분리 (PacketOpcode::Lookup이 넘긴 '|' 뒤 부분 -> 필드 조각들)
+// - 한 번 훑으며 '|' 위치만 기록 (memchr - 표준 라이브러리가 SIMD로 찾음), 필드는 원본을 가리키는 string_view (복사/할당 없음)
+// - 타입별 꺼내기는 실패하면 false (예외 없음) - 핸들러는 false면 에러 응답
+// 클라이언트 include/core/PacketFields.h와 같은 내용
+namespace Packet {
+    // 필드 전체가 10진 정수일 때만 true (std::stoi와 달리 예외/할당 없음)
+    template<typename Integer>
+    inline bool ParseInt(std::string_view text, Integer& value) {
+        const char* end = text.data() + text.size();
+        auto result = std::from_chars(text.data(), end, value);
+        return result.ec == std::errc() && result.ptr == end;
+    }
+
+    class Fields {
+    public:
+        // 가장 긴 패킷 ALL_CARDS (카드 25장 x 3필드) + 여유 - 넘으면 마지막 필드에 나머지가 통째로 담김
+        static constexpr size_t MAX_FIELDS = 80;
+
+        // 빈 문자열은 필드 0개, "a|" 는 "a", "" 두 개
+        explicit Fields(std::string_view text) : text_(text) {
+            if (text.empty()) return;
+
+            const char* begin = text.data();
+            const char* end = begin + text.size();
+            const char* cursor = begin;
+            while (count_ + 1 < MAX_FIELDS) {
+                auto* pipe = static_cast<const char*>(std::memchr(cursor, '|', static_cast<size_t>(end - cursor)));
+                if (!pipe) break;
+                ends_[count_++] = static_cast<uint32_t>(pipe - begin);
+                cursor = pipe + 1;
+            }
+            ends_[count_++] = static_cast<uint32_t>(text.size());
+        }
+
+        size_t Count() const { return count_; }
+        bool Has(size_t index) const { return index < count_; }
+
+        // index번째 필드 (없으면 빈 조각)
+        std::string_view operator[](size_t index) const {
+            if (index >= count_) return std::string_view();
+            size_t begin = Begin(index);
+            return text_.substr(begin, ends_[index] - begin);
+        }
+
+        // index번째 필드부터 끝까지 ('|'가 들어갈 수 있는 마지막 필드 - 채팅, 닉네임)
+        std::string_view Rest(size_t index) const {
+            return index < count_ ? text_.substr(Begin(index)) : std::string_view();
+        }
+
+        bool GetString(size_t index, std::string_view& value) const {
+            if (index >= count_) return false;
+            value = (*this)[index];
+            return true;
+        }
+
+        bool GetString(size_t index, std::string& value) const {
+            if (index >= count_) return false;
+            value.assign((*this)[index]);
+            return true;
+        }
+
+        // int / long long 등 (GAME_START 타임스탬프는 64비트)
+        template<typename Integer>
+        bool GetInt(size_t index, Integer& value) const {
+            static_assert(std::is_integral<Integer>::value, "GetInt은 정수 타입만");
+            return index < count_ && ParseInt((*this)[index], value);
+        }
+
+        // 0 ~ last 범위의 정수를 열거형으로
+        template<typename Enum>
+        bool GetEnum(size_t index, Enum& value, Enum last) const {
+            using Underlying = typename std::underlying_type<Enum>::type;
+            long long number = 0;
+            if (!GetInt(index, number) || number < 0 || number > static_cast<long long>(static_cast<Underlying>(last))) {
+                return false;
+            }
+            value = static_cast<Enum>(number);
+            return true;
+        }
+
+    private:
+        size_t Begin(size_t index) const { return index == 0 ? 0 : ends_[index - 1] + 1; }
+
+        std::string_view text_;
+        size_t count_ = 0;
+        uint32_t ends_[MAX_FIELDS]; // 필드 끝 위치 (count_개만 씀 - 초기화 비용 없음)
+    };
+}
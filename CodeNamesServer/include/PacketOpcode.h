@@ -0,0 +1,174 @@
+#pragma once
+
+#include "PacketProtocol.h"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <string_view>
+#include <utility>
+
+// 패킷 이름 -> 조밀한 opcode (컴파일 타임 완전 해시)
+// - 첫 토큰('|' 앞)을 해시해 슬롯 하나만 보고, 슬롯에 있는 이름 전체와 비교해 확인
+//   (CMD|QUERY_WAIT 같은 두 토큰 이름도 첫 토큰이 겹치지 않으므로 그대로 찾음)
+// - 해시 seed는 컴파일할 때 충돌이 없을 때까지 찾음 -> 런타임 비용은 해시 1번 + 비교 1번
+// - opcode는 핸들러 표(함수 포인터 배열)의 인덱스 - 바이너리 프로토콜의 opcode(BinaryCodec)와는 별개로 바뀔 수 있음
+// 클라이언트 include/core/PacketOpcode.h와 같은 목록
+enum class Opcode : uint8_t {
+    NONE, // 모르는 패킷
+
+    // wire format 협상
+    PROTO, PROTO_OK,
+
+    // 로비 / 매칭 / 세션
+    CMD_QUERY_WAIT, WAIT_REPLY, QUEUE_FULL, QUEUE_ERROR, INVALID_TOKEN, SESSION_ACK,
+    SESSION_NOT_FOUND, CANCEL_OK, LOBBY_ERROR_UNKNOWN, HEARTBEAT,
+
+    // 인증
+    CHECK_ID, CHECK_ID_DUPLICATE, CHECK_ID_OK, CHECK_ID_ERROR,
+    SIGNUP, SIGNUP_OK, SIGNUP_DUPLICATE, SIGNUP_ERROR,
+    LOGIN, LOGIN_OK, LOGIN_NO_ACCOUNT, LOGIN_WRONG_PW, LOGIN_SUSPENDED, LOGIN_ERROR,
+    TOKEN, TOKEN_VALID, EDIT_NICK, NICKNAME_EDIT_OK, NICKNAME_EDIT_ERROR, AUTH_ERROR_UNKNOWN,
+
+    // 게임
+    GAME_INIT, ALL_CARDS, CARD_UPDATE, TURN_UPDATE, HINT, CHAT, ANSWER, ANSWER_RESULT,
+    GAME_OVER, GAME_NOT_IMPLEMENTED,
+
+    // 서버 제어 / 에러
+    GAME_CREATE_ERROR, GAME_ERROR, SERVER_BUSY, RATE_LIMITED,
+
+    // 기타 명령과 응답
+    MATCHING_CANCEL, SESSION_READY, READY_TO_GO, GET_ROLE, GET_ALL_CARDS, GAME_START,
+    GAME_FAILED, ROLE_INFO, EVENT_QUEUE_FULL, REPORT, REPORT_OK, REPORT_ERROR,
+    GENERIC_ERROR, // PKT_ERROR (Windows의 ERROR 매크로와 겹치지 않도록)
+
+    COUNT
+};
+
+namespace PacketOpcode {
+    constexpr size_t COUNT = static_cast<size_t>(Opcode::COUNT);
+
+    // opcode 순서와 같아야 함
+    constexpr std::string_view NAMES[COUNT] = {
+        "",
+        PKT_PROTO, PKT_PROTO_OK,
+
+        PKT_CMD_QUERY_WAIT, PKT_WAIT_REPLY, PKT_QUEUE_FULL, PKT_QUEUE_ERROR, PKT_INVALID_TOKEN, PKT_SESSION_ACK,
+        PKT_SESSION_NOT_FOUND, PKT_CANCEL_OK, PKT_LOBBY_ERROR_UNKNOWN, PKT_HEARTBEAT,
+
+        PKT_CHECK_ID, PKT_CHECK_ID_DUPLICATE, PKT_CHECK_ID_OK, PKT_CHECK_ID_ERROR,
+        PKT_SIGNUP, PKT_SIGNUP_OK, PKT_SIGNUP_DUPLICATE, PKT_SIGNUP_ERROR,
+        PKT_LOGIN, PKT_LOGIN_OK, PKT_LOGIN_NO_ACCOUNT, PKT_LOGIN_WRONG_PW, PKT_LOGIN_SUSPENDED, PKT_LOGIN_ERROR,
+        PKT_TOKEN, PKT_TOKEN_VALID, PKT_EDIT_NICK, PKT_NICKNAME_EDIT_OK, PKT_NICKNAME_EDIT_ERROR, PKT_AUTH_ERROR_UNKNOWN,
+
+        PKT_GAME_INIT, PKT_ALL_CARDS, PKT_CARD_UPDATE, PKT_TURN_UPDATE, PKT_HINT_MSG, PKT_CHAT, PKT_ANSWER, PKT_ANSWER_RESULT,
+        PKT_GAME_OVER, PKT_GAME_NOT_IMPLEMENTED,
+
+        PKT_GAME_CREATE_ERROR, PKT_GAME_ERROR, PKT_SERVER_BUSY, PKT_RATE_LIMITED,
+
+        PKT_MATCHING_CANCEL, PKT_SESSION_READY, PKT_READY_TO_GO, PKT_GET_ROLE, PKT_GET_ALL_CARDS, PKT_GAME_START,
+        PKT_GAME_FAILED, PKT_ROLE_INFO, PKT_EVENT_QUEUE_FULL, PKT_REPORT, PKT_REPORT_OK, PKT_REPORT_ERROR,
+        PKT_ERROR,
+    };
+
+    constexpr std::string_view Name(Opcode opcode) { return NAMES[static_cast<size_t>(opcode)]; }
+
+    constexpr std::string_view FirstToken(std::string_view text) {
+        return text.substr(0, text.find('|'));
+    }
+
+    // FNV-1a
+    constexpr uint32_t HashToken(std::string_view token) {
+        uint32_t hash = 2166136261u;
+        for (char c : token) {
+            hash = (hash ^ static_cast<uint8_t>(c)) * 16777619u;
+        }
+        return hash;
+    }
+
+    constexpr size_t SLOT_BITS = 9; // 60개 남짓을 512칸에 - 충돌 없는 seed를 몇십 번 안에 찾음
+    constexpr size_t SLOT_COUNT = size_t(1) << SLOT_BITS;
+
+    constexpr size_t Slot(uint32_t hash, uint32_t seed) {
+        return static_cast<uint32_t>(hash * seed) >> (32 - SLOT_BITS);
+    }
+
+    struct HashTable {
+        uint32_t seed;
+        std::array<Opcode, SLOT_COUNT> slots;
+    };
+
+    constexpr bool FirstTokensUnique() {
+        for (size_t i = 1; i < COUNT; ++i) {
+            for (size_t j = i + 1; j < COUNT; ++j) {
+                if (FirstToken(NAMES[i]) == FirstToken(NAMES[j])) return false;
+            }
+        }
+        return true;
+    }
+    static_assert(FirstTokensUnique(), "패킷 이름의 첫 토큰이 겹치면 첫 토큰만으로 찾을 수 없음");
+
+    constexpr HashTable BuildTable() {
+        for (uint32_t seed = 0x9E3779B1u, attempt = 0; attempt < 100000; seed += 2, ++attempt) {
+            HashTable table{ seed, {} };
+            bool collided = false;
+            for (size_t i = 1; i < COUNT && !collided; ++i) {
+                size_t slot = Slot(HashToken(FirstToken(NAMES[i])), seed);
+                if (table.slots[slot] != Opcode::NONE) {
+                    collided = true;
+                } else {
+                    table.slots[slot] = static_cast<Opcode>(i);
+                }
+            }
+            if (!collided) return table;
+        }
+        return HashTable{ 0, {} };
+    }
+
+    inline constexpr HashTable TABLE = BuildTable();
+    static_assert(TABLE.seed != 0, "충돌 없는 해시 seed를 찾지 못함 - SLOT_BITS를 늘릴 것");
+
+    // data("TYPE" 또는 "TYPE|fields")의 opcode (모르면 NONE)
+    // hasFields: 이름 뒤에 '|'가 있는지, fields: '|' 뒤 부분 (data를 가리킴)
+    constexpr Opcode Lookup(std::string_view data, std::string_view& fields, bool& hasFields) {
+        Opcode opcode = TABLE.slots[Slot(HashToken(FirstToken(data)), TABLE.seed)];
+        std::string_view name = Name(opcode);
+        if (opcode == Opcode::NONE || data.size() < name.size() || data.compare(0, name.size(), name) != 0) {
+            return Opcode::NONE;
+        }
+
+        hasFields = data.size() > name.size();
+        if (hasFields && data[name.size()] != '|') return Opcode::NONE;
+        fields = hasFields ? data.substr(name.size() + 1) : std::string_view();
+        return opcode;
+    }
+
+    // 이름 뒤에 필드가 붙은 패킷만 (Packet::MatchType과 같은 규칙 - 클라이언트 명령은 모두 필드가 있음)
+    constexpr Opcode LookupCommand(std::string_view data, std::string_view& fields) {
+        bool hasFields = false;
+        Opcode opcode = Lookup(data, fields, hasFields);
+        return hasFields ? opcode : Opcode::NONE;
+    }
+
+    // 이름 그대로의 opcode (표 구성용)
+    constexpr Opcode Find(std::string_view name) {
+        std::string_view fields;
+        bool hasFields = false;
+        Opcode opcode = Lookup(name, fields, hasFields);
+        return hasFields ? Opcode::NONE : opcode;
+    }
+
+    // opcode -> 핸들러 표 (지정하지 않은 opcode는 nullptr)
+    template<typename Handler>
+    using HandlerTable = std::array<Handler, COUNT>;
+
+    template<typename Handler>
+    constexpr HandlerTable<Handler> MakeTable(std::initializer_list<std::pair<Opcode, Handler>> entries) {
+        HandlerTable<Handler> table{};
+        for (const auto& entry : entries) {
+            table[static_cast<size_t>(entry.first)] = entry.second;
+        }
+        return table;
+    }
+}
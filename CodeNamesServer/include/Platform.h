@@ -0,0 +1,52 @@
+#pragma once
+
+// 플랫폼별 소켓 헤더와 타입을 한 곳에서 맞춰주는 헤더
+// Windows는 Winsock2를 그대로 사용하고, Linux에서는 필요한 Winsock 이름만 POSIX로 대응시킨다.
+
+#ifdef _WIN32
+
+#define WIN32_LEAN_AND_MEAN
+#include <winsock2.h>
+#include <ws2tcpip.h>
+#include <Windows.h>
+
+#else
+
+#include <sys/types.h>
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <arpa/inet.h>
+#include <unistd.h>
+#include <cerrno>
+#include <cstring>
+#include <cstdint>
+
+using SOCKET = int;
+using DWORD = uint32_t;
+using ULONG = uint32_t;
+using ULONG_PTR = uintptr_t;
+
+constexpr SOCKET INVALID_SOCKET = -1;
+constexpr int SOCKET_ERROR = -1;
+
+// Winsock WSABUF와 같은 필드 순서 유지
+struct WSABUF {
+    ULONG len;
+    char* buf;
+};
+
+// Linux 백엔드는 OVERLAPPED를 사용하지 않지만 OverlappedEx 레이아웃을 맞추기 위해 자리만 둔다
+struct OVERLAPPED {
+    ULONG_PTR Internal;
+    ULONG_PTR InternalHigh;
+    uint64_t Offset;
+    void* hEvent;
+};
+
+inline int closesocket(SOCKET socket) { return ::close(socket); }
+inline int WSAGetLastError() { return errno; }
+
+#define ZeroMemory(dest, len) std::memset((dest), 0, (len))
+
+#endif
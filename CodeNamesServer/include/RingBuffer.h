@@ -0,0 +1,48 @@
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// 세션별 수신 재조립 버퍼 (고정 크기 원형 버퍼)
+// - TCP는 메시지 경계를 보존하지 않으므로 수신한 바이트를 쌓아두고
+//   구분자로 끝나는 완전한 프레임만 꺼낸다 (남은 조각은 다음 수신과 이어붙임)
+// - 저장 공간은 처음 Write할 때 할당 (프레임이 수신 한 번에 딱 끊겨 오는 연결은 할당하지 않음)
+class RingBuffer {
+public:
+    explicit RingBuffer(size_t capacity);
+
+    // 연속된 버퍼 [data, data + length)에서 프레임 1개를 바로 꺼냄 (성공 시 data/length를 소비한 만큼 전진)
+    // 재조립 버퍼가 비어 있을 때 받은 버퍼를 복사 없이 나누는 용도
+    static bool ExtractFrame(const char*& data, size_t& length, char delimiter, std::string_view& frame);
+
+    // 공간이 부족하면 아무것도 쓰지 않고 false
+    bool Write(const char* data, size_t length);
+
+    // 구분자까지의 프레임 1개를 꺼냄 (구분자와 끝의 '\r'은 제외), 완전한 프레임이 없으면 false
+    // frame은 다음 Write/ExtractFrame 전까지만 유효 (버퍼 끝에서 감긴 프레임만 내부 임시 버퍼로 이어붙임)
+    bool ExtractFrame(char delimiter, std::string_view& frame);
+
+    // 길이 접두 프레임용 (바이너리 프로토콜)
+    // Peek: 앞에서 최대 n바이트를 dst로 복사하고 복사한 수를 돌려줌 (소비하지 않음)
+    // Consume: 앞의 skip바이트를 버리고 이어지는 length바이트를 돌려주며 둘 다 소비 (Size() 이하여야 함)
+    //          반환값의 유효 범위는 ExtractFrame과 같음
+    size_t Peek(char* dst, size_t n) const;
+    std::string_view Consume(size_t skip, size_t length);
+
+    void Clear();
+
+    size_t Size() const { return size_; }
+    size_t Capacity() const { return capacity_; }
+    size_t FreeSpace() const { return capacity_ - size_; }
+    size_t AllocatedBytes() const { return buffer_.size(); }
+
+private:
+    std::vector<char> buffer_;
+    size_t capacity_;
+    size_t head_;      // 읽기 위치
+    size_t size_;      // 저장된 바이트 수
+    size_t scanned_;   // 구분자가 없다고 확인된 앞부분 길이 (재탐색 방지)
+    std::string wrapped_; // 감긴 프레임 이어붙이기용 (용량 재사용)
+};
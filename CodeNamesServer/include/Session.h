@@ -1,12 +1,18 @@
 #pragma once
 
-#define WIN32_LEAN_AND_MEAN
-#include <winsock2.h>
-#include <ws2tcpip.h>
-#include <Windows.h>
+#include "Platform.h"
+#include "RingBuffer.h"
+#include "SessionHandle.h"
+#include "TimingWheel.h"
+#include "TokenBucket.h"
+#include <atomic>
 #include <memory>
 #include <string>
+#include <string_view>
 #include <mutex>
+#include <deque>
+#include <cstdint>
+#include <vector>
 
 // IOCP 작업 종류
 enum class IOOperation {
@@ -25,20 +31,135 @@ enum class SessionState {
 
 // 버퍼 크기 상수
 constexpr int SESSION_BUFFER_SIZE = 4096;
+constexpr int MAX_FRAME_SIZE = SESSION_BUFFER_SIZE;          // 구분자 포함 프레임 최대 길이
+constexpr int RECV_RING_SIZE = SESSION_BUFFER_SIZE * 2;      // 미완성 프레임 + 수신 1회분
+constexpr int MAX_SEND_GATHER = 16;                          // 송신 1회에 묶어 보내는 최대 메시지 수
 
-// IOCP 사용 확장 구조체
+// 상태별 무응답 제한 시간 (마지막 수신 또는 상태 변경 이후, 넘으면 세션 종료)
+constexpr int64_t AUTH_TIMEOUT_MS = 30 * 1000;               // 접속 후 로그인까지
+constexpr int64_t LOBBY_IDLE_TIMEOUT_MS = 10 * 60 * 1000;    // 로비 / 매칭 대기
+constexpr int64_t GAME_HEARTBEAT_TIMEOUT_MS = 5 * 60 * 1000; // 게임 중 (아무 패킷이나 PING)
+
+// 송신 대기 바이트 (큐 + 전송 중) 상한 - 느린 수신자 때문에 메모리가 계속 늘지 않도록
+constexpr size_t SEND_HIGH_WATER_BYTES = 64 * 1024;   // 넘으면 느린 수신자 정책 적용
+constexpr size_t SEND_HARD_LIMIT_BYTES = 256 * 1024;  // 넘으면 정책과 무관하게 연결 종료
+
+// 느린 수신자 정책 (송신 대기 바이트가 SEND_HIGH_WATER_BYTES를 넘은 뒤 새 메시지 처리)
+enum class SlowConsumerPolicy {
+    DISCONNECT, // 바로 연결 종료
+    DROP_CHAT,  // CHAT은 버림
+    COLLAPSE    // CHAT은 버리고, TURN_UPDATE / 같은 카드의 CARD_UPDATE는 큐의 이전 것을 지우고 최신 것만 보냄 (기본)
+};
+
+// 송신 우선순위 (세션마다 등급별 대기 큐)
+// 평소에는 등급과 무관하게 넣은 순서대로 보내고, 송신 대기가 SEND_HIGH_WATER_BYTES를 넘은 동안만 높은 등급부터 채움
+// (같은 등급 안에서는 항상 순서 유지)
+enum class SendPriority {
+    CRITICAL, // 게임 진행 (매칭 결과, GAME_INIT / ALL_CARDS / HINT / CARD_UPDATE / TURN_UPDATE / ANSWER_RESULT / GAME_OVER)
+    NORMAL,   // 인증 / 로비 응답, 에러 알림
+    LOW,      // CHAT - 밀리면 가장 먼저 버림
+    COUNT
+};
+
+// 패킷 속도 제한 분류 (세션마다 분류별 토큰 버킷 1개, 디스패치 전에 확인)
+enum class RateClass {
+    AUTH,   // 인증 상태의 모든 패킷 (LOGIN / SIGNUP 등은 DB 조회)
+    CHAT,   // 게임 중 CHAT (방 전체 브로드캐스트)
+    ANSWER, // 게임 중 ANSWER / HINT
+    COUNT
+};
+constexpr uint32_t RATE_LIMIT_DISCONNECT_COUNT = 200; // 연속으로 이만큼 거절되면 연결 종료
+
+// 수신 버퍼 방식
+enum class RecvBufferMode {
+    ON_DEMAND, // 버퍼 없이 수신을 걸어두고 데이터가 도착했을 때만 풀에서 버퍼를 붙임 (기본)
+               // (IOCP: 0바이트 WSARecv 후 직접 읽기, epoll: 읽기 가능 시, io_uring: 공유 provided buffer에서 복사 시)
+    POSTED     // 수신마다 세션 버퍼 크기의 버퍼를 미리 잡아 걸어둠 (유휴 연결도 버퍼를 계속 보유)
+};
+
+// 연결별 wire format (접속 시 TEXT, PROTO|BIN1 협상 후 양방향 BINARY - BinaryCodec.h)
+// 게임 로직은 계속 텍스트 메시지를 다루고, 변환은 세션의 송수신 경계에서만 함
+enum class WireFormat {
+    TEXT,  // "TYPE|f1|...\n"
+    BINARY // [varint 길이][opcode][필드]
+};
+
+// 세션별 송신 지연 통계 (누가 밀리고 있는지 확인용)
+struct SendStats {
+    size_t outstandingBytes = 0; // 지금 큐 + 전송 중인 바이트
+    size_t peakBytes = 0;        // 최대 송신 대기 바이트
+    uint64_t dropped = 0;        // 버린 CHAT 수
+    uint64_t collapsed = 0;      // 최신 상태로 대체되어 지운 메시지 수
+    bool lagging = false;        // 상한을 넘은 상태
+};
+
+// 송신 프레임 (불변) - 브로드캐스트 시 수신자 전원의 송신이 같은 버퍼를 참조하고
+// 마지막 송신이 완료되어 참조가 모두 사라지면 해제된다
+struct OutboundPayload {
+    std::string text; // 텍스트 프레임 (구분자 포함)
+
+    // 바이너리 프레임 - 바이너리 연결로 처음 보낼 때 한 번만 변환해 보관 (수신자마다 다시 변환하지 않음)
+    const std::string& Binary() const;
+
+private:
+    mutable std::once_flag binaryOnce_; // 여러 샤드에서 동시에 보내도 변환은 한 번
+    mutable std::string binary_;
+};
+using SharedPayload = std::shared_ptr<const OutboundPayload>;
+
+// 한 세션에 한 번에 넘기는 송신 묶음 (게임 액션 하나에서 나온 메시지들)
+struct OutboundFrame {
+    SharedPayload payload;
+    SendPriority priority;
+};
+using OutboundFrames = std::vector<OutboundFrame>;
+
+// IOCP 사용 확장 구조체 (epoll/io_uring 백엔드도 동일한 구조체로 완료를 전달)
+// IoContextPool에서만 생성/반납 (버퍼는 구조체 바로 뒤에 함께 할당됨)
 struct OverlappedEx : public OVERLAPPED {
     IOOperation operation; // 작업
     WSABUF wsaBuf; // 소켓 버퍼
-    char buffer[SESSION_BUFFER_SIZE];
-    class Session* session; // 세션 포인터
+    char* buffer;          // 크기 클래스별 버퍼
+    ULONG bufferCapacity;
+    uint8_t sizeClass;     // IoContextPool 크기 클래스
+
+    // ACCEPT 전용 - 완료 시 acceptSocket은 수락된 소켓, buffer 앞부분은 상대 주소(sockaddr_in)
+    SOCKET listenSocket;
+    SOCKET acceptSocket;
+
+    // RECV 전용 - 버퍼 없이 건 수신이 완료됐을 때 백엔드가 직접 읽을 소켓 (IOCP)
+    SOCKET recvSocket;
+
+    // 모아 보내기 (gather) - sendBufCount가 0이면 wsaBuf 단일 버퍼로 송신
+    WSABUF sendBufs[MAX_SEND_GATHER];
+    DWORD sendBufCount;
+    std::vector<SharedPayload> sendPayloads; // sendBufs가 가리키는 데이터 (완료까지 참조 유지)
+
+    OverlappedEx(IOOperation op, char* buf, ULONG capacity, uint8_t cls)
+        : buffer(buf), bufferCapacity(capacity), sizeClass(cls) {
+        Reset(op);
+    }
 
-    OverlappedEx(IOOperation op, Session* sess = nullptr) : operation(op), session(sess) {
+    // 재사용 시 초기화 (버퍼 내용은 덮어쓸 것이므로 0으로 채우지 않음)
+    void Reset(IOOperation op) {
         // OVERLAPPED는 Windows 구조체이므로 ZeroMemory가 안전하다고 함
         ZeroMemory(static_cast<OVERLAPPED*>(this), sizeof(OVERLAPPED));
-        ZeroMemory(buffer, sizeof(buffer));
+        operation = op;
+        listenSocket = INVALID_SOCKET;
+        acceptSocket = INVALID_SOCKET;
+        recvSocket = INVALID_SOCKET;
+        sendBufCount = 0;
         wsaBuf.buf = buffer;
-        wsaBuf.len = sizeof(buffer);
+        wsaBuf.len = bufferCapacity;
+    }
+
+    WSABUF* SendBuffers() { return sendBufCount ? sendBufs : &wsaBuf; }
+    DWORD SendBufferCount() const { return sendBufCount ? sendBufCount : 1; }
+    size_t SendLength() const {
+        if (sendBufCount == 0) return wsaBuf.len;
+        size_t total = 0;
+        for (DWORD i = 0; i < sendBufCount; ++i) total += sendBufs[i].len;
+        return total;
     }
 };
 
@@ -55,6 +176,8 @@ class Session : public std::enable_shared_from_this<Session> {
 private:
     SOCKET socket_;
     class NetworkManager* networkManager_;
+    int shardIndex_; // 소유 샤드 (이 세션의 I/O와 송신 큐는 이 샤드의 워커가 처리)
+    SessionHandle handle_; // SessionSlotMap 핸들 (등록 시 발급, I/O 백엔드의 CompletionKey)
 
     // 매니저 참조 (소유권 없음, 단순 참조)
     class GameManager* gameManager_;      // 게임방별 고유 매니저
@@ -68,8 +191,28 @@ private:
     SessionState currentState_; // 세션 상태
 
     // 버퍼 및 뮤텍스
-    std::mutex sendLock_;
-    bool isClosed_;
+    mutable std::mutex sendLock_;         // sendQueues_, isSending_ 보호
+    struct QueuedSend {
+        SharedPayload payload;
+        uint64_t sequence; // 등급이 달라도 넣은 순서를 알 수 있도록
+    };
+    std::deque<QueuedSend> sendQueues_[static_cast<int>(SendPriority::COUNT)]; // 등급별 송신 대기 프레임
+    bool isSending_;                      // 송신 요청이 진행 중인지 (세션당 최대 1개)
+    bool flushDeferred_;                  // 워커의 완료 배치 끝에서 송신하도록 등록됨
+    bool closeAfterSend_;                 // 대기 중인 송신이 모두 끝나면 닫음 (CloseAfterSend)
+    size_t queuedBytes_;                  // 전체 대기 큐의 바이트 수 (sendLock_ 보호, 이하 동일)
+    size_t inflightBytes_;                // 전송 중인 바이트 수
+    uint64_t sendSequence_;               // 다음에 넣을 프레임의 순번
+    SendStats sendStats_;
+    WireFormat sendFormat_;               // 송신 형식 (formatSwitchFrame_을 송신 요청에 담는 순간 BINARY로)
+    SharedPayload formatSwitchFrame_;     // 이 프레임(PROTO_OK|BIN1)까지 텍스트, 이후 바이너리
+    WireFormat recvFormat_;               // 수신 형식 (수신 처리에서만 사용, 락 불필요)
+    std::string decodedPacket_;           // 바이너리 프레임을 복원한 텍스트 (다음 패킷 전까지 유효)
+    RingBuffer recvBuffer_; // 프레임 재조립 버퍼 (수신은 세션당 1개씩이라 락 불필요)
+    std::atomic<bool> isClosed_;          // 타임아웃 / 드레인 / 다른 워커의 수신 오류에서 동시에 Close할 수 있음
+    std::atomic<int64_t> lastActivityMs_; // 마지막 수신/상태 변경 시각 (타이밍 휠이 만료 시 확인)
+    TokenBucket rateBuckets_[static_cast<int>(RateClass::COUNT)]; // 수신 처리에서만 사용 (락 불필요)
+    uint32_t rateRejectStreak_;           // 연속으로 거절된 패킷 수
 
     // 로그인 후 UserInfo
     UserInfo userInfo_;
@@ -82,19 +225,78 @@ public:
     // 세션 초기화/종료
     bool Initialize();
     void Close();
+    void CloseAfterSend(const std::string& message); // message까지 보낸 뒤 닫음 (드레인 시 재접속 안내)
+    void Reuse(SOCKET sock); // SessionPool 전용 - 닫힌 세션을 새 연결용으로 초기화 (문자열 / 큐 / 버퍼 용량은 유지)
 
     // 네트워크 작업
     bool PostRecv();
-    bool PostSend(const std::string& data);
+    bool PostSend(const std::string& data); // 우선순위는 메시지 종류로 정함 (ClassifyOutbound)
+    bool PostSend(const std::string& data, SendPriority priority);
+    bool PostSend(const SharedPayload& payload); // 브로드캐스트용 (복사 없이 참조만 큐에 넣음)
+    bool PostSend(const SharedPayload& payload, SendPriority priority); // 받는 세션마다 분류하지 않도록 미리 정한 우선순위로
+    bool PostSend(const OutboundFrames& frames); // 묶음 전체를 한 번에 큐에 넣고 한 번의 송신으로 보냄
+    static SharedPayload MakePayload(const std::string& message);
+    static SendPriority ClassifyOutbound(std::string_view frame);
     void ProcessRecv(size_t bytesTransferred, struct OverlappedEx* overlapped);
     void ProcessSend(size_t bytesTransferred);
+    void FlushDeferredSend(); // 완료 배치 끝에서 NetworkManager가 호출
+    void DispatchPacket(std::string_view packet); // packet은 수신 버퍼를 가리킴 (이번 호출 동안만 유효)
+
+    SendStats GetSendStats() const;
+
+    // 느린 수신자 정책 (서버 전체 공통, 시작 시 설정)
+    static void SetSlowConsumerPolicy(SlowConsumerPolicy policy);
+    static SlowConsumerPolicy GetSlowConsumerPolicy();
+    static bool ParseSlowConsumerPolicy(const std::string& name, SlowConsumerPolicy& policy);
+    static size_t GetLaggingCount(); // 지금 상한을 넘은 세션 수
+
+    static void SetRecvBufferMode(RecvBufferMode mode);
+    static RecvBufferMode GetRecvBufferMode();
+    static bool ParseRecvBufferMode(const std::string& name, RecvBufferMode& mode);
+    static size_t GetRecvRingBytes(); // 전체 세션의 재조립 버퍼 할당량 (연결당 메모리 통계용)
+
+    // 패킷 속도 제한 (서버 전체 공통, 워커 시작 전에 설정)
+    static void SetRateLimit(RateClass rateClass, RateLimit limit);
+    static RateLimit GetRateLimit(RateClass rateClass);
+    static bool ParseRateLimit(const std::string& spec); // "chat=5/10" (초당 5개, 최대 10개) 또는 "off"
+    static uint64_t GetRateLimitedCount(); // 지금까지 거절한 패킷 수
+
+private:
+    enum class OutboundAction { ENQUEUE, DROP, DISCONNECT };
+
+    // 속도 제한 확인 (통과하면 true, 거절하면 패킷을 버리고 false)
+    bool AdmitPacket(std::string_view packet, int64_t nowMs);
+
+    // 수신 프레임 꺼내기 (recvFormat_에 따라 텍스트 / 바이너리, 바이너리는 decodedPacket_로 복원)
+    // 잘못된 바이너리 프레임이면 연결을 닫고 false
+    bool NextPacket(const char*& data, size_t& remaining, std::string_view& packet); // 받은 버퍼에서 바로
+    bool NextBufferedPacket(std::string_view& packet);                               // 재조립 버퍼에서
+    bool DecodePacket(std::string_view body, std::string_view& packet);
+    void NegotiateFormat(std::string_view format); // PROTO|format 처리
+    bool ClassifyPacket(std::string_view packet, RateClass& rateClass) const;
+
+    bool EnqueueSend(const SharedPayload& payload, SendPriority priority);
+    bool EnqueueFrame(const SharedPayload& payload, SendPriority priority); // sendLock_ 보유 상태에서 호출 (끊어야 하면 false)
+    bool StartQueuedSend();                                     // sendLock_ 보유 상태에서 호출
+    bool CloseSlowConsumer(size_t outstanding);
+    OutboundAction ApplyBackpressure(const std::string& frame, SendPriority priority); // sendLock_ 보유 상태에서 호출
+    void DropQueued(SendPriority priority);                     // sendLock_ 보유 상태에서 호출
+    void ClearSendQueues();                                     // sendLock_ 보유 상태에서 호출
+    void UpdateLagging(size_t outstanding);                     // sendLock_ 보유 상태에서 호출
+    bool FlushSendQueue(); // sendLock_ 보유 상태에서 호출
+    std::deque<QueuedSend>* NextSendQueue(bool byPriority); // 다음에 보낼 프레임이 있는 큐 (sendLock_ 보유 상태에서 호출)
+    // 소유 샤드가 아닌 스레드에서 호출되면 송신을 소유 샤드로 넘기고 true
+    template<typename... Args>
+    bool ForwardToOwnerShard(const Args&... args);
+
+public:
 
     // 상태 접근자
     bool IsAuthenticated() const { return !token_.empty(); }
-    const std::string GetNickname() const { return username_; }
+    const std::string& GetNickname() const { return username_; }
     void SetNickname(const std::string& name) { username_ = name; }
     void SetToken(const std::string& token) { token_ = token; }
-    void SetState(SessionState state) { currentState_ = state; }
+    void SetState(SessionState state) { currentState_ = state; Touch(); } // 상태가 바뀌면 제한 시간도 새로 시작
 
     // 로그인
     bool Login(const std::string& id, const std::string& pw); // DB 조회 후 userInfo_ 설정
@@ -103,7 +305,16 @@ public:
     void SetLoggedIn(bool loggedIn) { isLoggedIn_ = loggedIn; }
 
     SOCKET GetSocket() const { return socket_; }
+    SessionHandle GetHandle() const { return handle_; }
+    void SetHandle(SessionHandle handle) { handle_ = handle; } // SessionManager 등록 시 설정
+    int GetShardIndex() const { return shardIndex_; }
+    void SetShardIndex(int index) { shardIndex_ = index; } // Associate 전에 설정
     SessionState GetState() const { return currentState_; }
+
+    // 타임아웃 (수신마다 시각만 기록, 휠은 건드리지 않음)
+    void Touch() { lastActivityMs_.store(TimingWheel::NowMs(), std::memory_order_relaxed); }
+    int64_t GetLastActivityMs() const { return lastActivityMs_.load(std::memory_order_relaxed); }
+    int64_t GetIdleTimeoutMs() const;
     bool IsClosed() const { return isClosed_; }
     const std::string& GetToken() const { return token_; }    
 
@@ -0,0 +1,24 @@
+#pragma once
+
+#include <cstdint>
+
+// 세션 핸들 = 슬롯 인덱스(32비트) + 세대(32비트)
+// - 슬롯이 재사용되면 세대가 바뀌므로 이전 세션을 가리키던 핸들(늦게 도착한 완료 등)은 조회에 실패한다
+// - 세대 0은 쓰지 않으므로 기본값은 "세션 없음" (리슨 소켓 등)
+// - I/O 백엔드에는 64비트 키로 넘김 (IOCP CompletionKey, epoll/io_uring 소켓 컨텍스트)
+struct SessionHandle {
+    uint32_t index = 0;
+    uint32_t generation = 0;
+
+    bool IsValid() const { return generation != 0; }
+
+    uint64_t ToKey() const { return (static_cast<uint64_t>(generation) << 32) | index; }
+    static SessionHandle FromKey(uint64_t key) {
+        return { static_cast<uint32_t>(key), static_cast<uint32_t>(key >> 32) };
+    }
+
+    bool operator==(const SessionHandle& other) const {
+        return index == other.index && generation == other.generation;
+    }
+    bool operator!=(const SessionHandle& other) const { return !(*this == other); }
+};
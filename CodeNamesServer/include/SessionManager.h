@@ -1,18 +1,19 @@
 #pragma once
 
-#define WIN32_LEAN_AND_MEAN
-#include <winsock2.h>
-#include <ws2tcpip.h>
+#include "Platform.h"
 #include <unordered_map>
 #include <queue>
 #include <memory>
 #include <string>
+#include <string_view>
 #include <mutex>
 #include <atomic>
 #include <thread>
 #include <unordered_map>
 
 #include "IMediator.h"
+#include "SessionSlotMap.h"
+#include "PacketFields.h"
 
 class Session;
 class IOCPServer;
@@ -21,11 +22,12 @@ class SessionManager { // 기존 프로젝트의 RoomManager 대체
 private:
     IMediator* server_; 
     
-    std::unordered_map<SOCKET, std::shared_ptr<Session>> sessions_;
-    std::unordered_map<std::string, SOCKET> tokenToSocket_; // 토큰 + 소켓 매핑
-    std::queue<SOCKET> matchingQueue_; //매칭 대기열
-    std::mutex sessionMutex_;
+    SessionSlotMap sessions_; // 세션 소유 (핸들로 조회, 자체 락)
+    std::unordered_map<std::string, SessionHandle> tokenToHandle_; // 토큰 + 세션 핸들 매핑
+    std::queue<SessionHandle> matchingQueue_; //매칭 대기열
+    std::mutex sessionMutex_; // tokenToHandle_, matchingQueue_ 보호
     std::atomic<size_t> sessionCount_;
+    std::atomic<bool> draining_; // 리슨 소켓을 넘겨준 뒤 true - 새 매칭 없음
 
 public:
     SessionManager(IMediator* server);
@@ -33,10 +35,11 @@ public:
 
     // 세션 관리
     bool AddSession(std::shared_ptr<Session> session);
-    void RemoveSession(SOCKET socket); // 검색으로 인한 오버헤드 최소화를 위해 소켓으로 제거
+    void RemoveSession(SessionHandle handle); // 슬롯 인덱스로 바로 찾아 제거
+    SessionSlotMap& GetSessionSlots() { return sessions_; }
     
     // 세션 조회 및 토큰 검증
-    std::shared_ptr<Session> FindSession(SOCKET socket);
+    std::shared_ptr<Session> FindSession(SessionHandle handle);
     std::shared_ptr<Session> FindSessionByToken(const std::string& token);
     bool ValidateToken(const std::string& token);
 
@@ -46,11 +49,14 @@ public:
     void RemoveFromMatchingQueue(std::shared_ptr<Session> session);
     void RequestGameRoomCreation(const std::vector<std::shared_ptr<Session>>& players);
 
+    // 드레인 시작 - 매칭을 멈추고 게임 중이 아닌 세션은 SERVER_BUSY를 보낸 뒤 닫음 (새 프로세스로 재접속)
+    void BeginDrain();
+
     // 로비/매칭 패킷 처리
-    void HandleLobbyPacket(class Session* session, const std::string& data);
+    void HandleLobbyPacket(class Session* session, std::string_view data);
 
     // 인증 패킷 처리 (CHECK_ID, SIGNUP, LOGIN, TOKEN, EDIT_NICK)
-    void HandleAuthProtocol(class Session* session, const std::string& data);
+    void HandleAuthProtocol(class Session* session, std::string_view data);
 
     // 브로드캐스트 기능(프로젝트에서는 사용 안함)
     // #comment - GPT는 이 기능이 실제 서비스에서 공지나 점검 등으로 사용될 수 있다고 한다, 학습용으로 추가
@@ -59,4 +65,18 @@ public:
     // 통계 및 관리
     size_t GetSessionCount() const;
     void DisconnectAll();
+
+private:
+    // 패킷별 핸들러 (HandleLobbyPacket / HandleAuthProtocol의 opcode 표에서 호출, fields는 이름 뒤를 한 번에 나눈 필드들)
+    using PacketHandler = void (SessionManager::*)(Session* session, const Packet::Fields& fields);
+
+    void HandleQueryWait(Session* session, const Packet::Fields& fields);
+    void HandleSessionReady(Session* session, const Packet::Fields& fields);
+    void HandleMatchingCancel(Session* session, const Packet::Fields& fields);
+
+    void HandleCheckId(Session* session, const Packet::Fields& fields);
+    void HandleSignup(Session* session, const Packet::Fields& fields);
+    void HandleLogin(Session* session, const Packet::Fields& fields);
+    void HandleToken(Session* session, const Packet::Fields& fields);
+    void HandleEditNick(Session* session, const Packet::Fields& fields);
 };
\ No newline at end of file
@@ -0,0 +1,45 @@
+#pragma once
+
+#include "Platform.h"
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+class Session;
+class NetworkManager;
+
+// Session 재사용 풀 (연결마다 문자열 / 송신 큐 / 수신 버퍼 / 뮤텍스를 새로 할당하지 않도록)
+// - Initialize에서 capacity개를 미리 만들어 두고, Acquire는 꺼내서 새 소켓으로 초기화 (Session::Reuse)
+// - 마지막 shared_ptr이 사라지면 해제 대신 Close 후 풀로 반납 (문자열 / 큐 / 수신 버퍼의 용량은 유지)
+// - shared_ptr 제어 블록도 미리 잡아둔 블록에서 할당 -> 세션 쪽은 평상시 연결 수락에 힙 할당 없음
+//   (epoll / io_uring 백엔드의 소켓 컨텍스트와 그 등록 표 항목은 연결마다 따로 할당됨)
+// - 풀이 비면 기존처럼 새로 할당 (overflow로 집계, 반납 시 그대로 해제)
+// 어느 스레드에서나 호출 가능 (free list는 뮤텍스 보호, 연결 수락 / 세션 해제 때만 잡음)
+class SessionPool {
+public:
+    static constexpr size_t CONTROL_BLOCK_SIZE = 128; // shared_ptr 제어 블록 1개 (삭제자 + 할당자 포함)
+    static constexpr size_t CONTROL_BLOCK_SLACK = 64; // 재사용 직전 이전 제어 블록이 아직 남아 있는 경우 대비
+
+    explicit SessionPool(NetworkManager* networkManager);
+    ~SessionPool();
+
+    SessionPool(const SessionPool&) = delete;
+    SessionPool& operator=(const SessionPool&) = delete;
+
+    bool Initialize(size_t capacity); // 0이면 풀 없이 매번 할당
+    std::shared_ptr<Session> Acquire(SOCKET socket);
+
+    // 통계
+    size_t GetCapacity() const;
+    size_t GetInUse() const;        // 지금 나가 있는 풀 세션 수
+    size_t GetHighWater() const;    // GetInUse의 최댓값 (풀 크기 조정용)
+    uint64_t GetOverflowCount() const; // 풀이 비어 새로 할당한 횟수
+
+private:
+    struct State; // 나가 있는 세션이 풀보다 오래 살아도 반납할 수 있도록 공유
+    struct Recycler;
+    template<typename T> struct BlockAllocator;
+
+    NetworkManager* networkManager_;
+    std::shared_ptr<State> state_;
+};
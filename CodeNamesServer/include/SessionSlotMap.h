@@ -0,0 +1,81 @@
+#pragma once
+
+#include "SessionHandle.h"
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+class Session;
+
+// 세션 슬롯 맵 (세션의 소유자, SessionManager가 보유)
+// - Insert: 빈 슬롯에 세션을 넣고 핸들 발급 / Remove: 슬롯 세대를 올려 기존 핸들을 모두 무효화
+// - Resolve: 핸들 -> Session* (세대 비교만, 락/참조 카운트 없음) - 워커의 완료 처리 경로에서 사용
+// - Remove된 세션은 바로 해제하지 않고 유예 목록에 두었다가, 그 전에 Resolve한 포인터를 들고 있을 수 있는
+//   워커가 모두 대기 상태(GetCompletions)를 한 번 지난 뒤 해제 (QSBR)
+// - Resolve는 등록된 워커가 ReaderBusy ~ ReaderIdle 사이에서만, 또는 워커가 모두 멈춘 뒤에만 사용
+//   그 밖의 스레드는 Lock으로 shared_ptr을 받아 사용
+class SessionSlotMap {
+public:
+    static constexpr uint32_t CHUNK_SIZE = 1024;  // 슬롯은 청크 단위로 할당 (주소가 바뀌지 않음)
+    static constexpr uint32_t MAX_CHUNKS = 1024;  // 최대 동시 세션 수 = CHUNK_SIZE * MAX_CHUNKS
+    static constexpr int MAX_READERS = 256;       // 등록 가능한 워커 수
+
+    SessionSlotMap();
+    ~SessionSlotMap();
+
+    SessionHandle Insert(std::shared_ptr<Session> session);
+    bool Remove(SessionHandle handle);
+
+    Session* Resolve(SessionHandle handle) const;
+    std::shared_ptr<Session> Lock(SessionHandle handle) const;
+    std::vector<std::shared_ptr<Session>> Snapshot() const;
+    std::vector<std::shared_ptr<Session>> Clear(); // 모두 제거하고 제거한 세션 목록 반환
+    size_t Size() const;
+
+    // 워커 등록 (워커 스레드 시작/종료 시 1번씩)
+    int RegisterReader();
+    void UnregisterReader(int reader);
+    // 완료를 받은 직후 ReaderBusy, 다시 대기하기 직전 ReaderIdle (이때 해제 가능한 세션 정리)
+    void ReaderBusy(int reader);
+    void ReaderIdle(int reader);
+
+private:
+    static constexpr uint64_t READER_IDLE = UINT64_MAX;
+
+    struct Slot {
+        std::atomic<uint32_t> generation{1};
+        std::atomic<Session*> session{nullptr};
+        std::shared_ptr<Session> owner; // mutex_ 보호
+    };
+
+    struct Retired {
+        std::shared_ptr<Session> session;
+        uint64_t epoch; // Remove 시점의 epoch - 모든 워커가 이보다 뒤의 epoch로 넘어가면 해제
+    };
+
+    // 워커마다 캐시 라인을 따로 써서 서로의 기록이 부딪히지 않도록
+    struct alignas(64) Reader {
+        std::atomic<uint64_t> epoch{READER_IDLE};
+        bool used = false; // mutex_ 보호
+    };
+
+    Slot* FindSlot(uint32_t index) const;
+    void Reclaim();
+
+    mutable std::mutex mutex_;
+    std::atomic<Slot*> chunks_[MAX_CHUNKS];
+    uint32_t slotCount_;              // 한 번이라도 사용된 슬롯 수
+    std::vector<uint32_t> freeSlots_;
+    size_t size_;
+
+    std::atomic<uint64_t> epoch_;
+    Reader readers_[MAX_READERS];
+    std::atomic<int> readerLimit_;    // 등록된 적 있는 워커 범위 (정리 시 여기까지만 확인)
+    std::mutex retiredMutex_;
+    std::deque<Retired> retired_;
+    std::atomic<bool> hasRetired_;
+};
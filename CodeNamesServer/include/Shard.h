@@ -0,0 +1,54 @@
+#pragma once
+
+#include "IOBackend.h"
+#include "TimingWheel.h"
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+// 샤드 = I/O 백엔드 1개 + 그 완료를 처리하는 워커 + 다른 스레드가 보낸 작업을 받는 메일박스
+// - 세션과 게임방은 소유 샤드가 정해져 있고, 소유 샤드의 워커만 그 상태를 건드린다
+// - 다른 샤드의 세션/게임방에 할 일이 있으면 Post로 작업을 넘기고 소유 샤드의 워커가 실행
+// - 공유 워커 모드에서는 샤드 1개를 모든 워커가 함께 처리 (모두 같은 샤드이므로 메일박스를 거치지 않음)
+// - 이 샤드 세션들의 타임아웃은 샤드의 타이밍 휠로 워커가 확인
+// - 워커 지연: 메일박스에 넣은 측정 작업이 실행되기까지 걸린 시간 (워커가 밀려 있을수록 길어짐, 과부하 판단용)
+class Shard {
+public:
+    Shard(int index, std::unique_ptr<IOBackend> backend);
+
+    int GetIndex() const { return index_; }
+    IOBackend* GetBackend() const { return backend_.get(); }
+    TimingWheel& GetTimers() { return timers_; }
+
+    // 작업을 메일박스에 넣고 워커를 깨움 (어느 스레드에서나 호출 가능)
+    void Post(std::function<void()> task);
+
+    // 워커 루프에서 호출 - 쌓인 작업을 모두 실행
+    void RunPending();
+    // 메일박스에 작업이 있는지 (락 없이 확인 - 바쁜 대기 중인 워커용)
+    bool HasPending() const { return hasPending_.load(std::memory_order_acquire); }
+
+    // 지연 측정 (통계 스레드가 주기적으로 호출) - 이전 측정 작업이 실행됐으면 새로 넣음
+    void ProbeLatency(int64_t nowMs);
+    // 마지막 측정값, 측정 작업이 아직 실행되지 않았으면 지금까지 기다린 시간이 더 크면 그 값
+    int64_t GetLatencyMs(int64_t nowMs) const;
+
+    // 현재 스레드가 처리 중인 샤드 (워커가 아니면 -1)
+    static int CurrentIndex();
+    static void SetCurrentIndex(int index);
+
+private:
+    int index_;
+    std::unique_ptr<IOBackend> backend_;
+    TimingWheel timers_;
+
+    std::mutex mailboxMutex_;
+    std::vector<std::function<void()>> mailbox_;
+    std::atomic<bool> hasPending_;
+
+    std::atomic<int64_t> probePostedMs_; // 실행 대기 중인 측정 작업을 넣은 시각 (0이면 없음)
+    std::atomic<int64_t> latencyMs_;
+};
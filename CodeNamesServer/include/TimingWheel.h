@@ -0,0 +1,47 @@
+#pragma once
+
+#include "SessionHandle.h"
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+// 세션 타임아웃용 해시 타이밍 휠 (샤드마다 1개)
+// - 슬롯마다 세션 핸들 목록만 두고, 틱마다 지난 슬롯을 통째로 꺼냄 -> 등록/만료 모두 O(1)
+// - 세션마다 타이머 객체를 두지 않음: 마지막 활동 시각은 Session이 기록하고 휠에는 핸들만 넣는다
+//   (수신마다 휠을 건드리지 않고, 슬롯이 돌아왔을 때 기한이 남았으면 남은 시간 위치로 다시 넣음)
+// - 이미 제거된 세션의 핸들은 조회에 실패하므로 휠에서 따로 지우지 않음
+class TimingWheel {
+public:
+    static constexpr size_t SLOT_COUNT = 512;   // 2의 거듭제곱 (한 바퀴 = SLOT_COUNT * TICK_MS)
+    static constexpr int64_t TICK_MS = 1000;
+
+    TimingWheel();
+
+    // delayMs 뒤에 확인 (한 바퀴보다 길면 한 바퀴 뒤에 확인하고 다시 넣음)
+    void Schedule(SessionHandle handle, int64_t delayMs);
+
+    // 지난 틱의 슬롯을 모두 꺼내 expired에 담음 (다른 워커가 진행 중이거나 지난 틱이 없으면 false)
+    bool Advance(int64_t nowMs, std::vector<SessionHandle>& expired);
+
+    // 다음 틱이 지났는지 (락 없이 확인 - 유휴 샤드를 깨울지 판단)
+    bool IsDue(int64_t nowMs) const {
+        return size_.load(std::memory_order_relaxed) > 0 &&
+               nowMs >= nextTickMs_.load(std::memory_order_relaxed);
+    }
+
+    size_t Size() const { return size_.load(std::memory_order_relaxed); }
+
+    static int64_t NowMs() {
+        using namespace std::chrono;
+        return duration_cast<milliseconds>(steady_clock::now().time_since_epoch()).count();
+    }
+
+private:
+    std::mutex mutex_;
+    std::vector<std::vector<SessionHandle>> slots_;
+    int64_t currentTick_;                  // 다음에 꺼낼 틱 (mutex_ 보호)
+    std::atomic<int64_t> nextTickMs_;      // currentTick_이 시작되는 시각
+    std::atomic<size_t> size_;
+};
@@ -0,0 +1,24 @@
+#pragma once
+
+#include <cstdint>
+
+// 토큰 버킷 설정 (perSec이 0이면 제한 없음)
+struct RateLimit {
+    uint32_t perSec = 0; // 초당 채워지는 토큰 수
+    uint32_t burst = 0;  // 최대로 쌓이는 토큰 수 (한 번에 몰아서 보낼 수 있는 패킷 수)
+};
+
+// 세션별 패킷 속도 제한용 토큰 버킷
+// - 패킷 1개가 토큰 1개를 소비하고, 토큰이 없으면 거절
+// - 세션의 수신 처리(세션당 한 번에 1개)에서만 사용하므로 락 없음
+// - 토큰을 1/1000 단위 정수로 보관 (경과 ms * 초당 토큰 수 = 채울 양, 나눗셈/부동소수점 없음)
+class TokenBucket {
+public:
+    bool TryConsume(const RateLimit& limit, int64_t nowMs);
+
+private:
+    static constexpr int64_t UNIT = 1000; // 토큰 1개
+
+    int64_t milliTokens_ = -1; // 음수면 아직 사용 전 (첫 패킷 때 가득 채움)
+    int64_t lastMs_ = 0;
+};
@@ -0,0 +1,454 @@
+#include "BinaryCodec.h"
+#include "PacketProtocol.h"
+#include "PacketOpcode.h"
+
+#include <array>
+#include <charconv>
+#include <cstring>
+#include <type_traits>
+
+namespace BinaryCodec {
+
+namespace {
+    // 필드 스키마 문자
+    //  s: 문자열 (다음 '|'까지, '|' 없음)   r: 나머지 전체 문자열 (마지막 필드, '|' 포함 가능)
+    //  i: int32   l: int64
+    //  +: 이후 필드들이 끝까지 반복되는 그룹   ?: 다음 필드 하나가 있을 수도 없을 수도 있음
+    // nullptr: 그 방향으로는 오지 않는 메시지 (오면 RAW로 보냄)
+    struct Message {
+        uint8_t opcode;
+        const char* name;     // 두 토큰짜리 이름(CMD|QUERY_WAIT 등)도 그대로
+        const char* toClient; // server -> client 필드
+        const char* toServer; // client -> server 필드
+    };
+
+    // opcode는 한 번 정하면 바꾸지 않음 (구버전 클라이언트와 호환) - 새 메시지는 빈 번호에 추가
+    constexpr Message MESSAGES[] = {
+        // 로비 / 매칭 / 세션
+        { 0x01, PKT_CMD_QUERY_WAIT,        nullptr, "s"    },
+        { 0x02, PKT_WAIT_REPLY,            "ii",    nullptr },
+        { 0x03, PKT_QUEUE_FULL,            "",      nullptr },
+        { 0x04, PKT_QUEUE_ERROR,           "",      nullptr },
+        { 0x05, PKT_INVALID_TOKEN,         "",      nullptr },
+        { 0x06, PKT_SESSION_ACK,           "",      nullptr },
+        { 0x07, PKT_SESSION_NOT_FOUND,     "",      nullptr },
+        { 0x08, PKT_CANCEL_OK,             "",      nullptr },
+        { 0x09, PKT_LOBBY_ERROR_UNKNOWN,   "",      nullptr },
+        { 0x0A, PKT_HEARTBEAT,             nullptr, ""     },
+        { 0x0B, PKT_PROTO,                 nullptr, "s"    },
+        { 0x0C, PKT_PROTO_OK,              "s",     nullptr },
+
+        // 인증
+        { 0x10, PKT_CHECK_ID,              nullptr, "r"    },
+        { 0x11, PKT_CHECK_ID_DUPLICATE,    "",      nullptr },
+        { 0x12, PKT_CHECK_ID_OK,           "",      nullptr },
+        { 0x13, PKT_CHECK_ID_ERROR,        "",      nullptr },
+        { 0x14, PKT_SIGNUP,                nullptr, "ssr"  },
+        { 0x15, PKT_SIGNUP_OK,             "s",     nullptr },
+        { 0x16, PKT_SIGNUP_DUPLICATE,      "",      nullptr },
+        { 0x17, PKT_SIGNUP_ERROR,          "",      nullptr },
+        { 0x18, PKT_LOGIN,                 nullptr, "sr"   },
+        { 0x19, PKT_LOGIN_OK,              "s",     nullptr },
+        { 0x1A, PKT_LOGIN_NO_ACCOUNT,      "",      nullptr },
+        { 0x1B, PKT_LOGIN_WRONG_PW,        "",      nullptr },
+        { 0x1C, PKT_LOGIN_SUSPENDED,       "",      nullptr },
+        { 0x1D, PKT_LOGIN_ERROR,           "",      nullptr },
+        { 0x1E, PKT_TOKEN,                 nullptr, "s"    },
+        { 0x1F, PKT_TOKEN_VALID,           "r",     nullptr },
+        { 0x20, PKT_EDIT_NICK,             nullptr, "sr"   },
+        { 0x21, PKT_NICKNAME_EDIT_OK,      "",      nullptr },
+        { 0x22, PKT_NICKNAME_EDIT_ERROR,   "",      nullptr },
+        { 0x23, PKT_AUTH_ERROR_UNKNOWN,    "",      nullptr },
+
+        // 게임
+        { 0x30, PKT_GAME_INIT,             "+siii", nullptr }, // nick|roleNum|team|leader 반복 (빈 슬롯은 EMPTY|0|0|0)
+        { 0x31, PKT_ALL_CARDS,             "+sii",  nullptr }, // word|type|isUsed 반복
+        { 0x32, PKT_CARD_UPDATE,           "iii",   nullptr },
+        { 0x33, PKT_TURN_UPDATE,           "iiii",  nullptr },
+        { 0x34, PKT_HINT_MSG,              "isi",   "si"   },  // s->c: team|word|count, c->s: word|count
+        { 0x35, PKT_CHAT,                  "iisr",  "r"    },  // s->c: team|roleNum|nick|message, c->s: message
+        { 0x36, PKT_ANSWER,                nullptr, "r"    },
+        { 0x37, PKT_ANSWER_RESULT,         "sr",    nullptr },
+        { 0x38, PKT_GAME_OVER,             "i",     nullptr },
+        { 0x39, PKT_GAME_NOT_IMPLEMENTED,  "",      nullptr },
+
+        // 서버 제어 / 에러
+        { 0x40, PKT_GAME_CREATE_ERROR,     "",      nullptr },
+        { 0x41, PKT_GAME_ERROR,            "",      nullptr },
+        { 0x42, PKT_SERVER_BUSY,           "",      nullptr },
+        { 0x43, PKT_RATE_LIMITED,          "s",     nullptr },
+        { 0x44, PKT_ERROR,                 "",      nullptr },
+
+        // 기타 client -> server 명령과 응답
+        { 0x50, PKT_MATCHING_CANCEL,       nullptr, "s"    },
+        { 0x51, PKT_SESSION_READY,         nullptr, "s"    },
+        { 0x52, PKT_READY_TO_GO,           nullptr, ""     },
+        { 0x53, PKT_GET_ROLE,              nullptr, ""     },
+        { 0x54, PKT_GET_ALL_CARDS,         nullptr, ""     },
+        { 0x55, PKT_GAME_START,            "l",     nullptr },
+        { 0x56, PKT_GAME_FAILED,           "r",     nullptr },
+        { 0x57, PKT_ROLE_INFO,             "i",     nullptr },
+        { 0x58, PKT_EVENT_QUEUE_FULL,      "",      nullptr },
+        { 0x59, PKT_REPORT,                nullptr, "sr"   },
+        { 0x5A, PKT_REPORT_OK,             "i?s",   nullptr }, // reportCount[|SUSPENDED]
+        { 0x5B, PKT_REPORT_ERROR,          "r",     nullptr },
+    };
+
+    // 패킷 opcode(PacketOpcode.h) -> 메시지 (이름 찾기는 완전 해시 한 번)
+    const Message* FindByPacketOpcode(Opcode opcode) {
+        static const std::array<const Message*, PacketOpcode::COUNT> table = [] {
+            std::array<const Message*, PacketOpcode::COUNT> byPacketOpcode{};
+            for (const Message& message : MESSAGES) {
+                byPacketOpcode[static_cast<size_t>(PacketOpcode::Find(message.name))] = &message;
+            }
+            byPacketOpcode[static_cast<size_t>(Opcode::NONE)] = nullptr;
+            return byPacketOpcode;
+        }();
+        return table[static_cast<size_t>(opcode)];
+    }
+
+    const Message* FindByOpcode(uint8_t opcode) {
+        static const std::array<const Message*, 256> table = [] {
+            std::array<const Message*, 256> byOpcode{};
+            for (const Message& message : MESSAGES) {
+                byOpcode[message.opcode] = &message;
+            }
+            return byOpcode;
+        }();
+        return table[opcode];
+    }
+
+    const char* SchemaFor(const Message& message, Direction direction) {
+        return direction == Direction::TO_CLIENT ? message.toClient : message.toServer;
+    }
+
+    // text에서 메시지 이름을 찾아 나머지 필드 부분을 돌려줌 (두 토큰 이름도 그대로)
+    const Message* FindMessage(std::string_view text, std::string_view& fields, bool& hasFields) {
+        return FindByPacketOpcode(PacketOpcode::Lookup(text, fields, hasFields));
+    }
+
+    // 텍스트 필드를 하나씩 꺼내는 커서
+    struct FieldReader {
+        std::string_view rest;
+        bool more; // 아직 꺼내지 않은 필드가 있는지 ("X|"의 빈 필드도 필드 하나)
+
+        bool Next(std::string_view& field) {
+            if (!more) return false;
+            size_t pos = rest.find('|');
+            if (pos == std::string_view::npos) {
+                field = rest;
+                rest = std::string_view();
+                more = false;
+            } else {
+                field = rest.substr(0, pos);
+                rest.remove_prefix(pos + 1);
+            }
+            return true;
+        }
+
+        bool Rest(std::string_view& field) {
+            if (!more) return false;
+            field = rest;
+            rest = std::string_view();
+            more = false;
+            return true;
+        }
+
+        size_t Remaining() const {
+            if (!more) return 0;
+            size_t count = 1;
+            for (char c : rest) {
+                if (c == '|') ++count;
+            }
+            return count;
+        }
+    };
+
+    // 다시 텍스트로 만들었을 때 같은 문자열이 되는 정수만 허용 ("007", "-0" 등은 RAW로)
+    template<typename T>
+    bool ParseCanonical(std::string_view text, T& value) {
+        const char* end = text.data() + text.size();
+        auto parsed = std::from_chars(text.data(), end, value);
+        if (parsed.ec != std::errc() || parsed.ptr != end) return false;
+
+        char buffer[24];
+        auto written = std::to_chars(buffer, buffer + sizeof(buffer), value);
+        return std::string_view(buffer, written.ptr - buffer) == text;
+    }
+
+    template<typename T>
+    void PutFixed(T value, std::string& out) {
+        using Unsigned = std::make_unsigned_t<T>;
+        Unsigned bits = static_cast<Unsigned>(value);
+        for (size_t i = 0; i < sizeof(T); ++i) {
+            out.push_back(static_cast<char>(bits & 0xFF));
+            bits = static_cast<Unsigned>(bits >> 8);
+        }
+    }
+
+    void PutString(std::string_view text, std::string& out) {
+        WriteVarint(static_cast<uint32_t>(text.size()), out);
+        out.append(text);
+    }
+
+    bool EncodeField(char type, FieldReader& reader, std::string& out) {
+        std::string_view field;
+        switch (type) {
+        case 's':
+            // '|'로 잘라 꺼냈으므로 '|'가 들어 있을 수 없음 (디코드 쪽도 '|'가 든 s 필드는 거부)
+            if (!reader.Next(field)) return false;
+            PutString(field, out);
+            return true;
+        case 'r':
+            if (!reader.Rest(field)) return false;
+            PutString(field, out);
+            return true;
+        case 'i': {
+            int32_t value;
+            if (!reader.Next(field) || !ParseCanonical(field, value)) return false;
+            PutFixed(value, out);
+            return true;
+        }
+        case 'l': {
+            int64_t value;
+            if (!reader.Next(field) || !ParseCanonical(field, value)) return false;
+            PutFixed(value, out);
+            return true;
+        }
+        }
+        return false;
+    }
+
+    bool EncodeFields(const char* schema, FieldReader& reader, std::string& out) {
+        for (const char* type = schema; *type; ++type) {
+            if (*type == '+') {
+                const char* group = type + 1;
+                size_t groupSize = strlen(group);
+                size_t fieldCount = reader.Remaining();
+                if (groupSize == 0 || fieldCount % groupSize != 0) return false;
+
+                WriteVarint(static_cast<uint32_t>(fieldCount / groupSize), out);
+                while (reader.more) {
+                    for (const char* field = group; *field; ++field) {
+                        if (!EncodeField(*field, reader, out)) return false;
+                    }
+                }
+                return true;
+            }
+
+            if (*type == '?') {
+                ++type;
+                out.push_back(reader.more ? 1 : 0);
+                if (!reader.more) continue;
+            }
+
+            if (!EncodeField(*type, reader, out)) return false;
+        }
+        return !reader.more; // 남는 필드가 있으면 스키마와 다른 메시지
+    }
+
+    bool EncodeBody(std::string_view text, Direction direction, std::string& out) {
+        std::string_view fields;
+        bool hasFields = false;
+        const Message* message = FindMessage(text, fields, hasFields);
+        if (!message) return false;
+
+        const char* schema = SchemaFor(*message, direction);
+        if (!schema) return false;
+
+        out.push_back(static_cast<char>(message->opcode));
+        FieldReader reader{ fields, hasFields };
+        return EncodeFields(schema, reader, out);
+    }
+
+    // 프레임 본문을 읽는 커서 (범위를 넘으면 false)
+    struct BodyReader {
+        const char* cursor;
+        const char* end;
+
+        size_t Left() const { return static_cast<size_t>(end - cursor); }
+
+        bool Varint(uint32_t& value) {
+            size_t headerBytes = 0;
+            value = 0;
+            for (size_t i = 0; i < MAX_VARINT_BYTES; ++i) {
+                if (cursor + i >= end) return false;
+                uint8_t byte = static_cast<uint8_t>(cursor[i]);
+                value |= static_cast<uint32_t>(byte & 0x7F) << (7 * i);
+                if (!(byte & 0x80)) {
+                    headerBytes = i + 1;
+                    break;
+                }
+            }
+            if (headerBytes == 0) return false;
+            cursor += headerBytes;
+            return true;
+        }
+
+        template<typename T>
+        bool Fixed(T& value) {
+            using Unsigned = std::make_unsigned_t<T>;
+            if (Left() < sizeof(T)) return false;
+            Unsigned bits = 0;
+            for (size_t i = 0; i < sizeof(T); ++i) {
+                bits |= static_cast<Unsigned>(static_cast<uint8_t>(cursor[i])) << (8 * i);
+            }
+            cursor += sizeof(T);
+            value = static_cast<T>(bits);
+            return true;
+        }
+
+        bool String(std::string_view& text) {
+            uint32_t length;
+            if (!Varint(length) || Left() < length) return false;
+            text = std::string_view(cursor, length);
+            cursor += length;
+            return true;
+        }
+    };
+
+    template<typename T>
+    void AppendNumber(T value, std::string& out) {
+        char buffer[24];
+        auto written = std::to_chars(buffer, buffer + sizeof(buffer), value);
+        out.append(buffer, written.ptr - buffer);
+    }
+
+    bool DecodeField(char type, BodyReader& reader, std::string& out) {
+        out.push_back('|');
+        switch (type) {
+        case 's':
+        case 'r': {
+            std::string_view text;
+            if (!reader.String(text) || text.find(PKT_DELIMITER) != std::string_view::npos) return false;
+            // 텍스트로 복원한 뒤 핸들러가 '|'로 다시 나누므로 s 필드의 '|'는 필드 경계를 바꿈 (SIGNUP 아이디 "a|b" 등)
+            if (type == 's' && text.find('|') != std::string_view::npos) return false;
+            out.append(text);
+            return true;
+        }
+        case 'i': {
+            int32_t value;
+            if (!reader.Fixed(value)) return false;
+            AppendNumber(value, out);
+            return true;
+        }
+        case 'l': {
+            int64_t value;
+            if (!reader.Fixed(value)) return false;
+            AppendNumber(value, out);
+            return true;
+        }
+        }
+        return false;
+    }
+
+    bool DecodeFields(const char* schema, BodyReader& reader, std::string& out) {
+        for (const char* type = schema; *type; ++type) {
+            if (*type == '+') {
+                const char* group = type + 1;
+                uint32_t count;
+                // 그룹 하나는 최소 1바이트 - 터무니없는 개수로 오래 도는 것 방지
+                if (!*group || !reader.Varint(count) || count > reader.Left()) return false;
+                for (uint32_t i = 0; i < count; ++i) {
+                    for (const char* field = group; *field; ++field) {
+                        if (!DecodeField(*field, reader, out)) return false;
+                    }
+                }
+                return true;
+            }
+
+            if (*type == '?') {
+                ++type;
+                if (reader.Left() < 1) return false;
+                char present = *reader.cursor++;
+                if (present == 0) continue;
+                if (present != 1) return false;
+            }
+
+            if (!DecodeField(*type, reader, out)) return false;
+        }
+        return true;
+    }
+}
+
+void WriteVarint(uint32_t value, std::string& out) {
+    while (value >= 0x80) {
+        out.push_back(static_cast<char>((value & 0x7F) | 0x80));
+        value >>= 7;
+    }
+    out.push_back(static_cast<char>(value));
+}
+
+void Encode(std::string_view text, Direction direction, std::string& out) {
+    size_t start = out.size();
+    out.push_back('\0'); // 본문 길이 자리 (대부분 1바이트, 128바이트 이상이면 뒤에서 늘림)
+
+    if (!EncodeBody(text, direction, out)) {
+        out.resize(start + 1);
+        out.push_back(static_cast<char>(OP_RAW));
+        out.append(text);
+    }
+
+    std::string header;
+    WriteVarint(static_cast<uint32_t>(out.size() - start - 1), header);
+    out[start] = header[0];
+    if (header.size() > 1) {
+        out.insert(start + 1, header, 1, std::string::npos);
+    }
+}
+
+bool Decode(std::string_view body, Direction direction, std::string& out) {
+    out.clear();
+    if (body.empty()) return false;
+
+    uint8_t opcode = static_cast<uint8_t>(body[0]);
+    if (opcode == OP_RAW) {
+        std::string_view text = body.substr(1);
+        if (text.empty() || text.find(PKT_DELIMITER) != std::string_view::npos) return false;
+        out.assign(text);
+        return true;
+    }
+
+    const Message* message = FindByOpcode(opcode);
+    if (!message) return false;
+
+    const char* schema = SchemaFor(*message, direction);
+    if (!schema) return false;
+
+    BodyReader reader{ body.data() + 1, body.data() + body.size() };
+    out.assign(message->name);
+    return DecodeFields(schema, reader, out) && reader.Left() == 0;
+}
+
+FrameStatus ReadHeader(const char* data, size_t length, size_t maxBody,
+                       size_t& headerBytes, size_t& bodyLength) {
+    uint32_t value = 0;
+    for (size_t i = 0; i < MAX_VARINT_BYTES; ++i) {
+        if (i >= length) return FrameStatus::INCOMPLETE;
+
+        uint8_t byte = static_cast<uint8_t>(data[i]);
+        value |= static_cast<uint32_t>(byte & 0x7F) << (7 * i);
+        if (!(byte & 0x80)) {
+            if (value == 0 || value > maxBody) return FrameStatus::MALFORMED;
+            headerBytes = i + 1;
+            bodyLength = value;
+            return FrameStatus::OK;
+        }
+    }
+    return FrameStatus::MALFORMED;
+}
+
+FrameStatus ExtractFrame(const char*& data, size_t& length, size_t maxBody, std::string_view& body) {
+    size_t headerBytes = 0;
+    size_t bodyLength = 0;
+    FrameStatus status = ReadHeader(data, length, maxBody, headerBytes, bodyLength);
+    if (status != FrameStatus::OK) return status;
+    if (length - headerBytes < bodyLength) return FrameStatus::INCOMPLETE;
+
+    body = std::string_view(data + headerBytes, bodyLength);
+    data += headerBytes + bodyLength;
+    length -= headerBytes + bodyLength;
+    return FrameStatus::OK;
+}
+
+}
@@ -0,0 +1,422 @@
+#ifdef __linux__
+
+#include "EpollBackend.h"
+#include "Session.h"
+#include "IoContextPool.h"
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <fcntl.h>
+#include <algorithm>
+#include <iostream>
+
+EpollBackend::EpollBackend() : epollFd_(-1), wakeupFd_(-1), shutdownFd_(-1), notifyFd_(-1) {
+}
+
+EpollBackend::~EpollBackend() {
+    // 남은 완료/대기 버퍼 정리
+    for (auto& completion : completions_) {
+        IoContextPool::Release(completion.overlapped);
+    }
+    completions_.clear();
+
+    for (auto& pair : contexts_) {
+        auto& context = pair.second;
+        IoContextPool::Release(context->pendingRecv);
+        for (auto* overlapped : context->pendingSends) {
+            IoContextPool::Release(overlapped);
+        }
+        for (auto* overlapped : context->pendingAccepts) {
+            IoContextPool::Release(overlapped);
+        }
+    }
+    contexts_.clear();
+
+    if (wakeupFd_ != -1) close(wakeupFd_);
+    if (shutdownFd_ != -1) close(shutdownFd_);
+    if (notifyFd_ != -1) close(notifyFd_);
+    if (epollFd_ != -1) close(epollFd_);
+}
+
+bool EpollBackend::Create() {
+    epollFd_ = epoll_create1(EPOLL_CLOEXEC);
+    if (epollFd_ == -1) {
+        std::cerr << "epoll_create1 failed: " << errno << std::endl;
+        return false;
+    }
+
+    wakeupFd_ = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC | EFD_SEMAPHORE);
+    shutdownFd_ = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    notifyFd_ = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    if (wakeupFd_ == -1 || shutdownFd_ == -1 || notifyFd_ == -1) {
+        std::cerr << "eventfd failed: " << errno << std::endl;
+        return false;
+    }
+
+    // 내부 eventfd들은 level-triggered로 등록 (값이 남아있는 동안 계속 깨어남)
+    epoll_event ev = {};
+    ev.events = EPOLLIN;
+    ev.data.fd = wakeupFd_;
+    if (epoll_ctl(epollFd_, EPOLL_CTL_ADD, wakeupFd_, &ev) == -1) {
+        std::cerr << "epoll_ctl (wakeup) failed: " << errno << std::endl;
+        return false;
+    }
+
+    ev.data.fd = shutdownFd_;
+    if (epoll_ctl(epollFd_, EPOLL_CTL_ADD, shutdownFd_, &ev) == -1) {
+        std::cerr << "epoll_ctl (shutdown) failed: " << errno << std::endl;
+        return false;
+    }
+
+    ev.data.fd = notifyFd_;
+    if (epoll_ctl(epollFd_, EPOLL_CTL_ADD, notifyFd_, &ev) == -1) {
+        std::cerr << "epoll_ctl (notify) failed: " << errno << std::endl;
+        return false;
+    }
+
+    std::cout << "epoll created successfully" << std::endl;
+    return true;
+}
+
+bool EpollBackend::Associate(SOCKET socket, SessionHandle session) {
+    // 리액터 방식이므로 소켓은 논블로킹이어야 함
+    int flags = fcntl(socket, F_GETFL, 0);
+    if (flags == -1 || fcntl(socket, F_SETFL, flags | O_NONBLOCK) == -1) {
+        std::cerr << "fcntl(O_NONBLOCK) failed: " << errno << std::endl;
+        return false;
+    }
+
+    auto context = std::make_shared<SocketContext>();
+    context->socket = socket;
+    context->session = session;
+
+    {
+        std::lock_guard<std::mutex> lock(contextsMutex_);
+        contexts_[socket] = context;
+    }
+
+    // 첫 PostRecv 전까지는 IN/OUT 관심 없이 등록만 해둔다
+    epoll_event ev = {};
+    ev.events = EPOLLET | EPOLLONESHOT | EPOLLRDHUP;
+    ev.data.fd = socket;
+    if (epoll_ctl(epollFd_, EPOLL_CTL_ADD, socket, &ev) == -1) {
+        std::cerr << "epoll_ctl (associate) failed: " << errno << std::endl;
+        std::lock_guard<std::mutex> lock(contextsMutex_);
+        contexts_.erase(socket);
+        return false;
+    }
+
+    return true;
+}
+
+void EpollBackend::Dissociate(SOCKET socket) {
+    std::shared_ptr<SocketContext> context;
+    {
+        std::lock_guard<std::mutex> lock(contextsMutex_);
+        auto it = contexts_.find(socket);
+        if (it == contexts_.end()) return;
+        context = std::move(it->second);
+        contexts_.erase(it);
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(context->lock);
+        epoll_ctl(epollFd_, EPOLL_CTL_DEL, socket, nullptr);
+
+        IoContextPool::Release(context->pendingRecv);
+        context->pendingRecv = nullptr;
+        for (auto* overlapped : context->pendingSends) {
+            IoContextPool::Release(overlapped);
+        }
+        context->pendingSends.clear();
+        for (auto* overlapped : context->pendingAccepts) {
+            IoContextPool::Release(overlapped);
+        }
+        context->pendingAccepts.clear();
+    }
+
+    // 리슨 소켓의 accept 완료는 워커가 받아서 새 소켓을 정리해야 하므로 남겨둠
+    if (!context->session.IsValid()) return;
+
+    // 아직 워커가 가져가지 않은 완료는 세션이 사라지기 전에 버림
+    std::lock_guard<std::mutex> lock(completionMutex_);
+    for (auto it = completions_.begin(); it != completions_.end();) {
+        if (it->session == context->session) {
+            IoContextPool::Release(it->overlapped);
+            it = completions_.erase(it);
+        } else {
+            ++it;
+        }
+    }
+}
+
+std::shared_ptr<EpollBackend::SocketContext> EpollBackend::FindContext(SOCKET socket) {
+    std::lock_guard<std::mutex> lock(contextsMutex_);
+    auto it = contexts_.find(socket);
+    return (it != contexts_.end()) ? it->second : nullptr;
+}
+
+bool EpollBackend::Rearm(SocketContext& context) {
+    uint32_t interest = 0;
+    if (context.pendingRecv || !context.pendingAccepts.empty()) interest |= EPOLLIN;
+    if (!context.pendingSends.empty()) interest |= EPOLLOUT;
+
+    // 기다리는 작업이 없으면 비무장 상태로 둔다 (HUP 이벤트가 계속 재발생하는 것 방지)
+    if (interest == 0) return true;
+
+    // MOD는 현재 준비 상태를 다시 검사하므로, 이미 도착한 데이터도 이벤트로 올라온다
+    epoll_event ev = {};
+    ev.events = interest | EPOLLET | EPOLLONESHOT | EPOLLRDHUP;
+    ev.data.fd = context.socket;
+    if (epoll_ctl(epollFd_, EPOLL_CTL_MOD, context.socket, &ev) == -1) {
+        std::cerr << "epoll_ctl (rearm) failed: " << errno << std::endl;
+        return false;
+    }
+    return true;
+}
+
+bool EpollBackend::PostRecv(SOCKET socket, OverlappedEx* overlapped) {
+    auto context = FindContext(socket);
+    if (!context) return false;
+
+    std::lock_guard<std::mutex> lock(context->lock);
+    if (context->pendingRecv) {
+        std::cerr << "PostRecv: 이미 대기 중인 수신이 있습니다 (소켓: " << socket << ")" << std::endl;
+        return false;
+    }
+
+    context->pendingRecv = overlapped;
+    if (!Rearm(*context)) {
+        context->pendingRecv = nullptr;
+        return false;
+    }
+    return true;
+}
+
+bool EpollBackend::PostSend(SOCKET socket, OverlappedEx* overlapped) {
+    auto context = FindContext(socket);
+    if (!context) return false;
+
+    std::deque<IOCompletion> completed;
+    {
+        std::lock_guard<std::mutex> lock(context->lock);
+        bool wasIdle = context->pendingSends.empty();
+        context->pendingSends.push_back(overlapped);
+
+        // 앞선 송신이 남아있으면 순서를 지키기 위해 EPOLLOUT 처리에 맡김
+        if (wasIdle) {
+            FlushSends(*context, completed);
+            Rearm(*context);
+        }
+    }
+
+    PushCompletions(completed);
+    return true;
+}
+
+bool EpollBackend::PostAccept(SOCKET listenSocket, OverlappedEx* overlapped) {
+    auto context = FindContext(listenSocket);
+    if (!context) return false;
+
+    std::lock_guard<std::mutex> lock(context->lock);
+    overlapped->listenSocket = listenSocket;
+    context->pendingAccepts.push_back(overlapped);
+    if (!Rearm(*context)) {
+        context->pendingAccepts.pop_back();
+        return false;
+    }
+    return true;
+}
+
+void EpollBackend::AcceptPending(SocketContext& context, std::deque<IOCompletion>& completed) {
+    // 한 번 깨어날 때 걸려있는 accept 수만큼 연속으로 수락
+    while (!context.pendingAccepts.empty()) {
+        OverlappedEx* overlapped = context.pendingAccepts.front();
+        socklen_t addrLength = sizeof(sockaddr_in);
+        SOCKET clientSocket = accept4(context.socket, reinterpret_cast<sockaddr*>(overlapped->buffer),
+                                      &addrLength, SOCK_NONBLOCK | SOCK_CLOEXEC);
+        if (clientSocket == INVALID_SOCKET) {
+            if (errno == EINTR || errno == ECONNABORTED) continue;
+            if (errno == EAGAIN || errno == EWOULDBLOCK) return;
+
+            // 리슨 소켓 종료 등 - 이번 요청만 실패로 완료
+            completed.push_back({ false, 0, SessionHandle(), overlapped });
+            context.pendingAccepts.pop_front();
+            return;
+        }
+
+        overlapped->acceptSocket = clientSocket;
+        completed.push_back({ true, 0, SessionHandle(), overlapped });
+        context.pendingAccepts.pop_front();
+    }
+}
+
+bool EpollBackend::FlushSends(SocketContext& context, std::deque<IOCompletion>& completed) {
+    while (!context.pendingSends.empty()) {
+        OverlappedEx* overlapped = context.pendingSends.front();
+        size_t totalLength = overlapped->SendLength();
+
+        // 이미 보낸 부분을 건너뛰고 남은 버퍼들을 sendmsg 한 번으로 전송 (writev와 동일)
+        iovec iov[MAX_SEND_GATHER];
+        msghdr msg = {};
+        msg.msg_iov = iov;
+        msg.msg_iovlen = BuildSendIovec(overlapped, context.sendOffset, iov);
+
+        ssize_t sent = sendmsg(context.socket, &msg, MSG_NOSIGNAL);
+        if (sent < 0) {
+            if (errno == EINTR) continue;
+            if (errno == EAGAIN || errno == EWOULDBLOCK) return true; // EPOLLOUT 대기
+
+            // 실제 에러 - 남은 송신은 모두 실패로 완료
+            std::cerr << "send failed: " << errno << " (소켓: " << context.socket << ")" << std::endl;
+            for (auto* failed : context.pendingSends) {
+                completed.push_back({ false, 0, context.session, failed });
+            }
+            context.pendingSends.clear();
+            context.sendOffset = 0;
+            return false;
+        }
+
+        context.sendOffset += static_cast<size_t>(sent);
+        if (context.sendOffset == totalLength) {
+            completed.push_back({ true, static_cast<DWORD>(totalLength), context.session, overlapped });
+            context.pendingSends.pop_front();
+            context.sendOffset = 0;
+        }
+    }
+    return true;
+}
+
+void EpollBackend::HandleSocketEvent(SOCKET socket, uint32_t events, std::deque<IOCompletion>& completed) {
+    auto context = FindContext(socket);
+    if (!context) return; // 이미 Dissociate된 소켓
+
+    {
+        std::lock_guard<std::mutex> lock(context->lock);
+
+        if ((events & (EPOLLIN | EPOLLHUP | EPOLLERR)) && !context->pendingAccepts.empty()) {
+            AcceptPending(*context, completed);
+        }
+
+        if ((events & (EPOLLIN | EPOLLRDHUP | EPOLLHUP | EPOLLERR)) && context->pendingRecv) {
+            // 버퍼 없이 걸린 수신이면 읽기 직전에 풀에서 버퍼를 붙임
+            OverlappedEx* overlapped = IoContextPool::AttachBuffer(context->pendingRecv, SESSION_BUFFER_SIZE);
+            context->pendingRecv = overlapped;
+
+            ssize_t received;
+            do {
+                received = recv(socket, overlapped->wsaBuf.buf, overlapped->wsaBuf.len, 0);
+            } while (received < 0 && errno == EINTR);
+
+            if (received >= 0) {
+                // 0 바이트는 상대방 종료 (IOCP와 동일하게 ProcessRecv에서 처리)
+                completed.push_back({ true, static_cast<DWORD>(received), context->session, overlapped });
+                context->pendingRecv = nullptr;
+            } else if (errno != EAGAIN && errno != EWOULDBLOCK) {
+                std::cerr << "recv failed: " << errno << " (소켓: " << socket << ")" << std::endl;
+                completed.push_back({ false, 0, context->session, overlapped });
+                context->pendingRecv = nullptr;
+            }
+        }
+
+        if ((events & (EPOLLOUT | EPOLLHUP | EPOLLERR)) && !context->pendingSends.empty()) {
+            FlushSends(*context, completed);
+        }
+
+        Rearm(*context);
+    }
+}
+
+void EpollBackend::PushCompletions(std::deque<IOCompletion>& completed, size_t callerTakes) {
+    if (completed.empty()) return;
+
+    {
+        std::lock_guard<std::mutex> lock(completionMutex_);
+        for (auto& completion : completed) {
+            completions_.push_back(completion);
+        }
+    }
+
+    // 호출한 워커가 바로 가져갈 몫을 뺀 나머지만큼 대기 중인 워커를 깨움 (EFD_SEMAPHORE)
+    uint64_t count = completed.size() - std::min<size_t>(callerTakes, completed.size());
+    if (count == 0) return;
+    ssize_t written = write(wakeupFd_, &count, sizeof(count));
+    (void)written;
+}
+
+int EpollBackend::PopCompletions(IOCompletion* completions, int maxCount) {
+    std::lock_guard<std::mutex> lock(completionMutex_);
+
+    int count = 0;
+    while (count < maxCount && !completions_.empty()) {
+        completions[count++] = completions_.front();
+        completions_.pop_front();
+    }
+    return count;
+}
+
+bool EpollBackend::GetCompletions(IOCompletion* completions, int maxCount, int& count, bool wait) {
+    maxCount = std::min<int>(std::max<int>(maxCount, 1), MAX_COMPLETION_BATCH);
+    count = 0;
+
+    while (true) {
+        // 먼저 쌓여있는 완료를 처리
+        count = PopCompletions(completions, maxCount);
+        if (count > 0) return true;
+
+        epoll_event events[MAX_COMPLETION_BATCH];
+        int eventCount = epoll_wait(epollFd_, events, maxCount, wait ? -1 : 0);
+        if (eventCount < 0) {
+            if (errno == EINTR) continue;
+            std::cerr << "epoll_wait failed: " << errno << std::endl;
+            return false;
+        }
+
+        // 받은 이벤트를 모두 처리 (ONESHOT이라 여기서 처리하지 않으면 재무장되지 않음)
+        std::deque<IOCompletion> completed;
+        bool shutdown = false;
+        bool notified = false;
+        for (int i = 0; i < eventCount; ++i) {
+            int fd = events[i].data.fd;
+            if (fd == shutdownFd_) {
+                shutdown = true; // 종료 신호 (읽지 않고 남겨두어 다른 워커도 종료)
+            } else if (fd == wakeupFd_) {
+                uint64_t value = 0;
+                ssize_t readBytes = read(wakeupFd_, &value, sizeof(value));
+                (void)readBytes;
+            } else if (fd == notifyFd_) {
+                // 여러 번 통지되어도 한 번 읽고 반환 (호출자가 쌓인 작업을 한꺼번에 처리)
+                uint64_t value = 0;
+                ssize_t readBytes = read(notifyFd_, &value, sizeof(value));
+                (void)readBytes;
+                notified = true;
+            } else {
+                HandleSocketEvent(fd, events[i].events, completed);
+            }
+        }
+
+        PushCompletions(completed, static_cast<size_t>(maxCount));
+        if (shutdown) return false;
+
+        count = PopCompletions(completions, maxCount);
+        if (count > 0 || notified || !wait) return true;
+    }
+}
+
+void EpollBackend::PostShutdown(int workerCount) {
+    (void)workerCount;
+    if (shutdownFd_ == -1) return;
+
+    uint64_t value = 1;
+    ssize_t written = write(shutdownFd_, &value, sizeof(value));
+    (void)written;
+}
+
+void EpollBackend::Wakeup() {
+    if (notifyFd_ == -1) return;
+
+    uint64_t value = 1;
+    ssize_t written = write(notifyFd_, &value, sizeof(value));
+    (void)written;
+}
+
+#endif // __linux__
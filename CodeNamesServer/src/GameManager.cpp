@@ -6,17 +6,19 @@
 #include "GameManager.h"
 #include "Session.h"
 #include "PacketProtocol.h"
+#include "PacketOpcode.h"
 #include <ctime>
 
-GameManager::GameManager(const std::string &roomId)
+GameManager::GameManager(const std::string &roomId, SessionSlotMap* sessions)
     : roomId_(roomId), currentTurn_(Team::RED), currentPhase_(GamePhase::HINT_PHASE),
-      redScore_(0), blueScore_(0), remainingTries_(0), hintCount_(0), gameOver_(false) 
+      redScore_(0), blueScore_(0), remainingTries_(0), hintCount_(0), gameOver_(false), shardIndex_(0),
+      sessions_(sessions), outboundDepth_(0)
 {
     std::cout << "GameManager 생성: " << roomId_ << std::endl;
     
     // 플레이어 배열 초기화
     for (int i = 0; i < MAX_PLAYERS; ++i) {
-        players_[i].session = nullptr;
+        players_[i].session = SessionHandle();
         players_[i].roleNum = i;
 
         players_[i].team = (i < 3) ? Team::RED : Team::BLUE; // 0,1,2: RED, 3,4,5: BLUE
@@ -48,22 +50,65 @@ GameManager::~GameManager() {
     }
 
     for (int i = 0; i < MAX_PLAYERS; ++i) {
-        if (players_[i].session) {
+        if (Session* session = GetPlayerSession(i)) {
             // Session 상태를 로비로 변경
-            players_[i].session->SetState(SessionState::IN_LOBBY);
+            session->SetState(SessionState::IN_LOBBY);
             
             // GameManager 참조 해제
-            players_[i].session->SetGameManager(nullptr);
-            players_[i].session = nullptr;
+            session->SetGameManager(nullptr);
         }
+        players_[i].session = SessionHandle();
+    }
+}
+
+Session* GameManager::GetPlayerSession(int index) const {
+    if (index < 0 || index >= MAX_PLAYERS || !sessions_) return nullptr;
+    if (!players_[index].IsOccupied()) return nullptr;
+    return sessions_->Resolve(players_[index].session);
+}
+
+GameManager::OutboundBatch::OutboundBatch(GameManager& game)
+    : game_(game), lock_(game.gameMutex_) {
+    ++game_.outboundDepth_;
+}
+
+GameManager::OutboundBatch::~OutboundBatch() {
+    if (--game_.outboundDepth_ == 0) {
+        game_.FlushOutbound();
+    }
+}
+
+void GameManager::SendToPlayer(int index, const SharedPayload& payload, SendPriority priority) {
+    if (outboundDepth_ > 0) {
+        if (players_[index].IsOccupied()) {
+            pendingSends_[index].push_back({ payload, priority });
+        }
+        return;
+    }
+
+    Session* session = GetPlayerSession(index);
+    if (session && !session->IsClosed()) {
+        session->PostSend(payload, priority);
+    }
+}
+
+void GameManager::FlushOutbound() {
+    for (int i = 0; i < MAX_PLAYERS; ++i) {
+        if (pendingSends_[i].empty()) continue;
+
+        Session* session = GetPlayerSession(i);
+        if (session && !session->IsClosed()) {
+            session->PostSend(pendingSends_[i]);
+        }
+        pendingSends_[i].clear(); // 용량은 남겨 다음 액션에서 재사용
     }
 }
 
 bool GameManager::AddPlayer(Session* session, const std::string& nickname, const std::string& token) {
     std::lock_guard<std::recursive_mutex> lock(gameMutex_);
 
-    if (!session) {
-        std::cerr << "AddPlayer: session이 nullptr입니다." << std::endl;
+    if (!session || !session->GetHandle().IsValid()) {
+        std::cerr << "AddPlayer: 등록되지 않은 세션입니다." << std::endl;
         return false;
     }
 
@@ -76,8 +121,10 @@ bool GameManager::AddPlayer(Session* session, const std::string& nickname, const
 
     // 빈 슬롯 찾기
     for (int i = 0; i < MAX_PLAYERS; ++i) {
-        if (players_[i].session == nullptr) {
-            players_[i].session = session;
+        if (!players_[i].IsOccupied()) {
+            players_[i].session = session->GetHandle();
+            players_[i].nickname = nickname;
+            players_[i].token = token;
             // roleNum, team, role 은 생성자에서 설정
 
             std::cout << "플레이어 추가: " << nickname 
@@ -98,11 +145,13 @@ void GameManager::RemovePlayer(const std::string& nickname) {
     std::lock_guard<std::recursive_mutex> lock(gameMutex_);
 
     for (int i = 0; i < MAX_PLAYERS; ++i) {
-        if (players_[i].session && players_[i].session->GetNickname() == nickname) {
+        if (players_[i].IsOccupied() && players_[i].nickname == nickname) {
             std::cout << "플레이어 제거: " << nickname << " (슬롯 " << i << ")" << std::endl;
-            players_[i].session->SetGameManager(nullptr);
-            players_[i].session->SetState(SessionState::IN_LOBBY);
-            players_[i].session = nullptr;
+            if (Session* session = GetPlayerSession(i)) {
+                session->SetGameManager(nullptr);
+                session->SetState(SessionState::IN_LOBBY);
+            }
+            players_[i].session = SessionHandle();
             return;
         }
     }
@@ -111,7 +160,7 @@ void GameManager::RemovePlayer(const std::string& nickname) {
 
 GamePlayer* GameManager::GetPlayer(const std::string& nickname) {
     for (int i = 0; i < MAX_PLAYERS; ++i) {
-        if (players_[i].session && players_[i].session->GetNickname() == nickname) {
+        if (players_[i].IsOccupied() && players_[i].nickname == nickname) {
             return &players_[i];
         }
     }
@@ -121,7 +170,7 @@ GamePlayer* GameManager::GetPlayer(const std::string& nickname) {
 
 GamePlayer* GameManager::GetPlayerByIndex(int index) {
     if (index >= 0 && index < MAX_PLAYERS) {
-        if (players_[index].session != nullptr) {
+        if (players_[index].IsOccupied()) {
             return &players_[index];
         }
     }
@@ -131,17 +180,29 @@ GamePlayer* GameManager::GetPlayerByIndex(int index) {
 size_t GameManager::GetPlayerCount() const {
     size_t count = 0;
     for (int i = 0; i < MAX_PLAYERS; ++i) {
-        if (players_[i].session != nullptr) {
+        if (players_[i].IsOccupied()) {
             count++;
         }
     }
     return count;
 }
 
+bool GameManager::IsFinished() {
+    std::lock_guard<std::recursive_mutex> lock(gameMutex_);
+    if (gameOver_) return true;
+
+    // 워커가 아닌 스레드에서도 부르므로 Resolve 대신 Lock으로 확인
+    for (int i = 0; i < MAX_PLAYERS; ++i) {
+        if (!players_[i].IsOccupied() || !sessions_) continue;
+        auto session = sessions_->Lock(players_[i].session);
+        if (session && !session->IsClosed()) return false;
+    }
+    return true;
+}
+
 int GameManager::FindPlayerIndex(const std::string& nickname) {
     for (int i = 0; i < MAX_PLAYERS; ++i) {
-        if (players_[i].session && 
-            players_[i].session->GetNickname() == nickname) {
+        if (players_[i].IsOccupied() && players_[i].nickname == nickname) {
             return i;
         }
     }
@@ -149,7 +210,7 @@ int GameManager::FindPlayerIndex(const std::string& nickname) {
 }
 
 bool GameManager::StartGame() {
-    std::lock_guard<std::recursive_mutex> lock(gameMutex_);
+    OutboundBatch batch(*this); // GAME_START ~ TURN_UPDATE를 플레이어마다 한 번에
 
     if (GetPlayerCount() != MAX_PLAYERS) {
         std::cerr << "StartGame: 플레이어가 부족합니다. 현재: " << GetPlayerCount() << "/6" << std::endl;
@@ -270,9 +331,7 @@ void GameManager::AssignCards() {
     std::cout << "카드 배치 완료" << std::endl;
 }
 
-void GameManager::SendAllCards(Session* session) {
-    std::lock_guard<std::recursive_mutex> lock(gameMutex_);
-
+std::string GameManager::CreateAllCardsMessage() {
     std::string cardsMsg = std::string(PKT_ALL_CARDS);
     for (int i = 0; i < MAX_CARDS; ++i) {
         std::string entry = "|" + cards_[i].word + 
@@ -280,7 +339,13 @@ void GameManager::SendAllCards(Session* session) {
                            "|" + std::to_string(cards_[i].isUsed ? 1 : 0);
         cardsMsg += entry;
     }
+    return cardsMsg;
+}
+
+void GameManager::SendAllCards(Session* session) {
+    std::lock_guard<std::recursive_mutex> lock(gameMutex_);
 
+    std::string cardsMsg = CreateAllCardsMessage();
     if (session && !session->IsClosed()) {
         session->PostSend(cardsMsg);
         std::cout << "[" << roomId_ << "] 모든 카드 정보 전송 to " << session->GetNickname() << "[" << cardsMsg << "]" << std::endl;
@@ -290,11 +355,15 @@ void GameManager::SendAllCards(Session* session) {
 }
 
 void GameManager::SendAllCardsToAll() {
+    std::lock_guard<std::recursive_mutex> lock(gameMutex_);
+
+    // 카드 정보는 모두에게 같으므로 프레임 1개를 공유
+    std::string cardsMsg = CreateAllCardsMessage();
+    SharedPayload payload = Session::MakePayload(cardsMsg);
     for (int i = 0; i < MAX_PLAYERS; ++i) {
-        if (players_[i].session) {
-            SendAllCards(players_[i].session);
-        }
+        SendToPlayer(i, payload, SendPriority::CRITICAL);
     }
+    std::cout << "[" << roomId_ << "] 모든 카드 정보 전송 [" << cardsMsg << "]" << std::endl;
 }
 
 void GameManager::SendCardUpdate(int cardIndex) {
@@ -317,10 +386,11 @@ void GameManager::BroadcastToAll(const std::string& message) {
 
     std::lock_guard<std::recursive_mutex> lock(gameMutex_);
 
+    // 프레임은 한 번만 만들고 모든 플레이어의 송신이 공유
+    SharedPayload payload = Session::MakePayload(message);
+    SendPriority priority = Session::ClassifyOutbound(message);
     for (int i = 0; i < MAX_PLAYERS; ++i) {
-        if (players_[i].session && !players_[i].session->IsClosed()) {
-            players_[i].session->PostSend(message);
-        }
+        SendToPlayer(i, payload, priority);
     }
     
     std::cout << "[" << roomId_ << "] 브로드캐스트: " << message << std::endl;
@@ -361,26 +431,16 @@ std::string GameManager::CreateGameInitMessage() {
         std::cout << "[" << roomId_ << "] CreateGameInitMessage - 플레이어 목록:" << std::endl;
 
         for (int i = 0; i < MAX_PLAYERS; ++i) {
-            if (players_[i].session) {
-                std::string nickname;
-                try {
-                    // 직접 세션의 GetNickname() 호출하여 디버깅
-                    Session* sess = players_[i].session;
-                    std::cout << "  [" << i << "] Session pointer: " << (void*)sess << std::endl;
-                    std::cout << "  [" << i << "] Calling GetNickname()..." << std::endl;
-                    nickname = sess->GetNickname();
-                    std::cout << "  [" << i << "] GetNickname() returned: '" << nickname << "'" << std::endl;
-                } catch (...) {
-                    nickname = "ERROR";
-                    std::cerr << "  [" << i << "] GetNickname() failed!" << std::endl;
-                }
+            if (players_[i].IsOccupied()) {
+                // 입장 시 저장한 닉네임 사용 (그 사이 연결이 끊겼어도 자리는 유지)
+                std::string nickname = players_[i].GetNickname();
                 
                 // Original C 버전과 동일하게 role_num (플레이어 인덱스 0~5), team, is_leader 전송
                 int roleNum = players_[i].roleNum;  // 플레이어 인덱스 (0~5)
                 int teamNum = static_cast<int>(players_[i].team);
                 std::string isLeader = (players_[i].role == PlayerRole::SPYMASTER) ? "1" : "0";
                 
-                std::cout << "  [" << i << "] Session: " << (void*)players_[i].session 
+                std::cout << "  [" << i << "] Session: " << players_[i].session.index
                          << ", Nickname: '" << nickname << "'"
                          << ", RoleNum: " << roleNum
                          << ", Team: " << teamNum 
@@ -413,9 +473,11 @@ void GameManager::BroadcastToTeam(Team team, const std::string& message) {
 
     std::lock_guard<std::recursive_mutex> lock(gameMutex_);
 
+    SharedPayload payload = Session::MakePayload(message);
+    SendPriority priority = Session::ClassifyOutbound(message);
     for (int i = 0; i < MAX_PLAYERS; ++i) {
-        if (players_[i].session && !players_[i].session->IsClosed() && players_[i].team == team) {
-            players_[i].session->PostSend(message);
+        if (players_[i].team == team) {
+            SendToPlayer(i, payload, priority);
         }
     }
 
@@ -464,7 +526,7 @@ void GameManager::SwitchPhase() {
     BroadcastToAll(phaseMsg);
 }
 
-bool GameManager::ProcessHint(int playerIndex, const std::string& word, int number) {
+bool GameManager::ProcessHint(int playerIndex, std::string_view word, int number) {
     std::lock_guard<std::recursive_mutex> lock(gameMutex_);
 
     // 유효성 검사, 부적합시 실행 x
@@ -474,14 +536,14 @@ bool GameManager::ProcessHint(int playerIndex, const std::string& word, int numb
     hintCount_ = number;
     remainingTries_ = number;
 
-    std::string hintMsg = std::string(PKT_HINT_MSG) + "|" + std::to_string((int)currentTurn_) + "|" + word + "|" + std::to_string(number);
+    std::string hintMsg = std::string(PKT_HINT_MSG) + "|" + std::to_string((int)currentTurn_) + "|" + hintWord_ + "|" + std::to_string(number);
     BroadcastToAll(hintMsg);
 
     SwitchPhase();
     return true;
 }
 
-bool GameManager::ProcessAnswer(int playerIndex, const std::string& word) {
+bool GameManager::ProcessAnswer(int playerIndex, std::string_view word) {
     std::lock_guard<std::recursive_mutex> lock(gameMutex_);
 
     // 유효성 검사
@@ -496,15 +558,16 @@ bool GameManager::ProcessAnswer(int playerIndex, const std::string& word) {
     }
 
     if (cardIndex == -1) {
-    // 잘못된 단어 - 해당 플레이어에게만 고지함
-    players_[playerIndex].session->PostSend(std::string(PKT_ANSWER_RESULT) + "|INVALID|" + word);
+        // 잘못된 단어 - 해당 플레이어에게만 고지함
+        SendToPlayer(playerIndex, Session::MakePayload(std::string(PKT_ANSWER_RESULT).append("|INVALID|").append(word)),
+                     SendPriority::CRITICAL);
         return false;
     }
 
     cards_[cardIndex].isUsed = true;
     CardType cardType = cards_[cardIndex].type;
 
-    std::string playerName = players_[playerIndex].GetNickname();
+    const std::string& playerName = players_[playerIndex].GetNickname();
 
     bool turnEnds = false;
     bool gameEnds = false;
@@ -560,25 +623,27 @@ bool GameManager::ProcessAnswer(int playerIndex, const std::string& word) {
     return true;
 }
 
-bool GameManager::ProcessChat(int playerIndex, const std::string &message)
+bool GameManager::ProcessChat(int playerIndex, std::string_view message)
 {
     std::lock_guard<std::recursive_mutex> lock(gameMutex_);
 
     if (gameOver_) return false;
-    if (playerIndex < 0 || playerIndex >= MAX_PLAYERS) return false;
-    if (players_[playerIndex].session == nullptr) return false;
-    if (players_[playerIndex].session->IsClosed()) return false;
+    Session* session = GetPlayerSession(playerIndex);
+    if (session == nullptr || session->IsClosed()) return false;
     if (message.empty()) return false;
 
     try {
-        std::string playerName = players_[playerIndex].GetNickname();
+        const std::string& playerName = players_[playerIndex].GetNickname();
         Team playerTeam = players_[playerIndex].team;
 
-        std::string chatMsg = std::string(PKT_CHAT) + "|" + 
-                            std::to_string((int)playerTeam) + "|" + 
-                            std::to_string(playerIndex) + "|" + 
-                            playerName + "|" + 
-                            message;
+        // CHAT|team|roleNum|nickname|message - 임시 문자열 없이 한 번에 조립
+        std::string chatMsg;
+        chatMsg.reserve(sizeof(PKT_CHAT) + 8 + playerName.size() + message.size());
+        chatMsg.append(PKT_CHAT).append("|")
+               .append(std::to_string((int)playerTeam)).append("|")
+               .append(std::to_string(playerIndex)).append("|")
+               .append(playerName).append("|")
+               .append(message);
 
         BroadcastToAll(chatMsg);
 
@@ -617,8 +682,11 @@ void GameManager::EndGame(Team winner)
     std::string gameOverMsg = std::string(PKT_GAME_OVER) + "|" + std::to_string((int)winner);
     BroadcastToAll(gameOverMsg);
 
+    // 결과 저장(DB)을 기다리지 않도록 지금까지 모은 메시지는 먼저 보냄
+    FlushOutbound();
+
     for (int i = 0; i < MAX_PLAYERS; ++i) {
-        if (players_[i].session) {
+        if (players_[i].IsOccupied()) {
             std::string nickname = players_[i].GetNickname();
             std::string result = (players_[i].team == winner) ? "WIN" : "LOSS";
             
@@ -639,9 +707,9 @@ void GameManager::EndGame(Team winner)
     }
 
     for (int i = 0; i < MAX_PLAYERS; ++i) {
-        if (players_[i].session) {
-            players_[i].session->SetState(SessionState::IN_LOBBY);
-            players_[i].session->SetGameManager(nullptr);
+        if (Session* session = GetPlayerSession(i)) {
+            session->SetState(SessionState::IN_LOBBY);
+            session->SetGameManager(nullptr);
         }
     }
 
@@ -650,7 +718,7 @@ void GameManager::EndGame(Team winner)
 }
 
 
-void GameManager::HandleGamePacket(Session* session, const std::string& data)
+void GameManager::HandleGamePacket(Session* session, std::string_view data)
 {
     if (!session || session->IsClosed() || data.empty()) {
         std::cerr << "HandleGamePacket: 유효하지 않은 세션 또는 데이터" << std::endl;
@@ -663,41 +731,52 @@ void GameManager::HandleGamePacket(Session* session, const std::string& data)
         return;
     }
     
-    if (data.find(std::string(PKT_HINT_MSG) + "|") == 0) { // "HINT|단어|숫자"
-        std::string params = data.substr(std::string(PKT_HINT_MSG).size() + 1);
-        
-        size_t pos = params.find('|');
-        if (pos != std::string::npos) {
-            std::string word = params.substr(0, pos); // |단어
-            std::string numberStr = params.substr(pos + 1); // |숫자
-
-            try { 
-                int number = std::stoi(numberStr);
-                ProcessHint(playerIndex, word, number); 
-            } catch (const std::exception& e) {
-                std::cerr << "HandleGamePacket: 숫자 파싱 오류: " << numberStr << std::endl;
-            }
-        }
-    } else if (data.find(std::string(PKT_ANSWER) + "|") == 0) { // "ANSWER|단어"
-        std::string word = data.substr(std::string(PKT_ANSWER).size() + 1);
-        ProcessAnswer(playerIndex, word);
-    } else if (data.find(std::string(PKT_CHAT) + "|") == 0) { // "CHAT|메시지"
-        std::string message = data.substr(std::string(PKT_CHAT).size() + 1);
-        ProcessChat(playerIndex, message);
-    } else {
+    // 이 패킷 처리 중에 나온 메시지는 끝날 때 플레이어마다 한 번에 송신
+    OutboundBatch batch(*this);
+
+    // opcode로 핸들러 표에서 바로 찾음, 필드는 data를 가리키는 조각 (복사 없음)
+    static constexpr auto handlers = PacketOpcode::MakeTable<PacketHandler>({
+        { Opcode::HINT,   &GameManager::HandleHintPacket },   // "HINT|단어|숫자"
+        { Opcode::ANSWER, &GameManager::HandleAnswerPacket }, // "ANSWER|단어"
+        { Opcode::CHAT,   &GameManager::HandleChatPacket },   // "CHAT|메시지"
+    });
+
+    std::string_view fields;
+    PacketHandler handler = handlers[static_cast<size_t>(PacketOpcode::LookupCommand(data, fields))];
+    if (!handler) {
         std::cerr << "HandleGamePacket: 알 수 없는 패킷 타입: " << data << std::endl;
+        return;
+    }
+    (this->*handler)(playerIndex, Packet::Fields(fields));
+}
+
+bool GameManager::HandleHintPacket(int playerIndex, const Packet::Fields& fields)
+{
+    int number = 0;
+    if (fields.Count() != 2) return false;
+    if (!fields.GetInt(1, number)) {
+        std::cerr << "HandleGamePacket: 숫자 파싱 오류: " << fields[1] << std::endl;
+        return false;
     }
+    return ProcessHint(playerIndex, fields[0], number);
+}
 
-    return;
+bool GameManager::HandleAnswerPacket(int playerIndex, const Packet::Fields& fields)
+{
+    return ProcessAnswer(playerIndex, fields[0]);
+}
+
+bool GameManager::HandleChatPacket(int playerIndex, const Packet::Fields& fields)
+{
+    return ProcessChat(playerIndex, fields.Rest(0));
 }
 
 bool GameManager::IsValidPlayerForHint(int playerIndex)
 {
     
     if (gameOver_) return false;
-    if (playerIndex < 0 || playerIndex >= MAX_PLAYERS) return false;
-    if (players_[playerIndex].session == nullptr) return false;
-    if (players_[playerIndex].session->IsClosed()) return false;
+    Session* session = GetPlayerSession(playerIndex);
+    if (session == nullptr || session->IsClosed()) return false;
     if (players_[playerIndex].team != currentTurn_) return false;
     if (currentPhase_ != GamePhase::HINT_PHASE) return false;
     if (players_[playerIndex].role != PlayerRole::SPYMASTER) return false;
@@ -708,9 +787,8 @@ bool GameManager::IsValidPlayerForHint(int playerIndex)
 bool GameManager::IsValidPlayerForAnswer(int playerIndex)
 {
     if (gameOver_) return false;
-    if (playerIndex < 0 || playerIndex >= MAX_PLAYERS) return false;
-    if (players_[playerIndex].session == nullptr) return false;
-    if (players_[playerIndex].session->IsClosed()) return false;
+    Session* session = GetPlayerSession(playerIndex);
+    if (session == nullptr || session->IsClosed()) return false;
     if (players_[playerIndex].role != PlayerRole::AGENT) return false;
     if (players_[playerIndex].team != currentTurn_) return false;
     if (currentPhase_ != GamePhase::GUESS_PHASE) return false;
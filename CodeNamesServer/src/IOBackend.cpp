@@ -0,0 +1,65 @@
+#include "IOBackend.h"
+#include "IOCPBackend.h"
+#include "EpollBackend.h"
+#include "IoUringBackend.h"
+#include "Session.h"
+#include <iostream>
+
+IOBackendType IOBackend::DefaultType() {
+#ifdef _WIN32
+    return IOBackendType::IOCP;
+#else
+    return IOBackendType::EPOLL;
+#endif
+}
+
+bool IOBackend::ParseType(const std::string& name, IOBackendType& type) {
+    if (name == "iocp") {
+        type = IOBackendType::IOCP;
+    } else if (name == "epoll") {
+        type = IOBackendType::EPOLL;
+    } else if (name == "io_uring" || name == "uring") {
+        type = IOBackendType::IO_URING;
+    } else {
+        return false;
+    }
+    return true;
+}
+
+std::unique_ptr<IOBackend> IOBackend::CreateBackend(IOBackendType type) {
+    switch (type) {
+#ifdef _WIN32
+    case IOBackendType::IOCP:
+        return std::make_unique<IOCPBackend>();
+#endif
+#ifdef __linux__
+    case IOBackendType::EPOLL:
+        return std::make_unique<EpollBackend>();
+    case IOBackendType::IO_URING:
+        return std::make_unique<IoUringBackend>();
+#endif
+    default:
+        std::cerr << "I/O backend not supported on this platform" << std::endl;
+        return nullptr;
+    }
+}
+
+#ifndef _WIN32
+size_t IOBackend::BuildSendIovec(OverlappedEx* overlapped, size_t offset, iovec* iov) {
+    WSABUF* buffers = overlapped->SendBuffers();
+    DWORD bufferCount = overlapped->SendBufferCount();
+
+    size_t count = 0;
+    for (DWORD i = 0; i < bufferCount; ++i) {
+        if (offset >= buffers[i].len) {
+            offset -= buffers[i].len; // 이미 전송된 버퍼
+            continue;
+        }
+        iov[count].iov_base = buffers[i].buf + offset;
+        iov[count].iov_len = buffers[i].len - offset;
+        offset = 0;
+        ++count;
+    }
+    return count;
+}
+#endif
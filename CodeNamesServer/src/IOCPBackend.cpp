@@ -0,0 +1,306 @@
+#ifdef _WIN32
+
+#include "IOCPBackend.h"
+#include "Session.h"
+#include "IoContextPool.h"
+#include <algorithm>
+#include <cstring>
+#include <iostream>
+
+IOCPBackend::IOCPBackend()
+    : iocpHandle_(nullptr), acceptEx_(nullptr), getAcceptExSockaddrs_(nullptr) {
+}
+
+IOCPBackend::~IOCPBackend() {
+    if (iocpHandle_) {
+        CloseHandle(iocpHandle_);
+        iocpHandle_ = nullptr;
+    }
+}
+
+bool IOCPBackend::Create() {
+    iocpHandle_ = CreateIoCompletionPort(
+        INVALID_HANDLE_VALUE, // 기존 파일 핸들 (소켓 연결용이 아닌 새로 생성)
+        NULL,                 // 기존 IOCP 핸들 (새로 생성하므로 NULL)
+        0,                    // CompletionKey (새로 생성하므로 0)
+        0                     // 동시 실행 스레드 수 (0 = 시스템이 결정)
+    );
+
+    if (iocpHandle_ == NULL) {
+        std::cerr << "CreateIoCompletionPort failed: " << GetLastError() << std::endl;
+        return false;
+    }
+
+    std::cout << "IOCP created successfully" << std::endl;
+    return true;
+}
+
+bool IOCPBackend::Associate(SOCKET socket, SessionHandle session) {
+    // Client 소켓을 생성된 IOCP에 연결
+    HANDLE result = CreateIoCompletionPort(
+        reinterpret_cast<HANDLE>(socket), // 소켓 핸들
+        iocpHandle_,                      // 기존 IOCP 핸들
+        static_cast<ULONG_PTR>(session.ToKey()), // CompletionKey로 세션 핸들 전달 (x64: 64비트)
+        0                                 // 동시 실행 스레드 수 (0 = 시스템이 결정)
+    );
+
+    if (result != iocpHandle_) {
+        std::cerr << "CreateIoCompletionPort (associate) failed: " << GetLastError() << std::endl;
+        return false;
+    }
+
+    // 세션 소켓은 논블로킹 (0바이트 수신 완료 후 직접 읽을 때 블로킹되지 않도록)
+    if (session.IsValid()) {
+        u_long nonBlocking = 1;
+        if (ioctlsocket(socket, FIONBIO, &nonBlocking) == SOCKET_ERROR) {
+            std::cerr << "ioctlsocket (FIONBIO) failed: " << WSAGetLastError() << std::endl;
+            return false;
+        }
+    }
+
+    return true;
+}
+
+bool IOCPBackend::PostRecv(SOCKET socket, OverlappedEx* overlapped) {
+    DWORD flags = 0;
+    DWORD bytesReceived = 0;
+    overlapped->recvSocket = socket; // 버퍼 없는 수신(0바이트)이면 완료 후 이 소켓에서 직접 읽음
+
+    int result = WSARecv(
+        socket,                     // 소켓
+        &overlapped->wsaBuf,        // 버퍼 정보
+        1,                          // 버퍼 개수
+        &bytesReceived,             // 받은 바이트 수
+        &flags,                     // 플래그
+        overlapped,                 // OVERLAPPED 구조체
+        nullptr                     // 완료 루틴 (사용 안함)
+    );
+
+    if (result == SOCKET_ERROR) {
+        int error = WSAGetLastError();
+        if (error != WSA_IO_PENDING) {
+            std::cerr << "WSARecv failed: " << error << std::endl;
+            return false;
+        }
+        // WSA_IO_PENDING: 비동기 작업이 진행 중일 경우
+    }
+
+    return true;
+}
+
+bool IOCPBackend::PostSend(SOCKET socket, OverlappedEx* overlapped) {
+    DWORD bytesSent = 0;
+
+    int result = WSASend(
+        socket,                     // 소켓
+        overlapped->SendBuffers(),  // 버퍼 정보 (여러 메시지를 모아 한 번에 송신)
+        overlapped->SendBufferCount(), // 버퍼 개수
+        &bytesSent,                 // 전송된 바이트 수
+        0,                          // 플래그
+        overlapped,                 // OVERLAPPED 구조체
+        nullptr                     // 완료 루틴
+    );
+
+    if (result == SOCKET_ERROR) {
+        int error = WSAGetLastError();
+        if (error != WSA_IO_PENDING) {
+            std::cerr << "WSASend failed: error=" << error << " (WSAGetLastError)" << std::endl;
+            return false;
+        }
+        // WSA_IO_PENDING: 비동기 작업이 진행 중일 경우
+    }
+
+    return true;
+}
+
+bool IOCPBackend::LoadAcceptExtensions(SOCKET listenSocket) {
+    if (acceptEx_ && getAcceptExSockaddrs_) return true;
+
+    GUID acceptExGuid = WSAID_ACCEPTEX;
+    GUID sockaddrsGuid = WSAID_GETACCEPTEXSOCKADDRS;
+    DWORD bytes = 0;
+
+    if (WSAIoctl(listenSocket, SIO_GET_EXTENSION_FUNCTION_POINTER,
+                 &acceptExGuid, sizeof(acceptExGuid), &acceptEx_, sizeof(acceptEx_),
+                 &bytes, nullptr, nullptr) == SOCKET_ERROR ||
+        WSAIoctl(listenSocket, SIO_GET_EXTENSION_FUNCTION_POINTER,
+                 &sockaddrsGuid, sizeof(sockaddrsGuid), &getAcceptExSockaddrs_, sizeof(getAcceptExSockaddrs_),
+                 &bytes, nullptr, nullptr) == SOCKET_ERROR) {
+        std::cerr << "WSAIoctl (AcceptEx) failed: " << WSAGetLastError() << std::endl;
+        acceptEx_ = nullptr;
+        getAcceptExSockaddrs_ = nullptr;
+        return false;
+    }
+    return true;
+}
+
+bool IOCPBackend::PostAccept(SOCKET listenSocket, OverlappedEx* overlapped) {
+    if (!LoadAcceptExtensions(listenSocket)) return false;
+
+    // AcceptEx는 수락할 소켓을 미리 만들어 넘겨야 함
+    SOCKET acceptSocket = WSASocket(AF_INET, SOCK_STREAM, IPPROTO_TCP, nullptr, 0, WSA_FLAG_OVERLAPPED);
+    if (acceptSocket == INVALID_SOCKET) {
+        std::cerr << "WSASocket (accept) failed: " << WSAGetLastError() << std::endl;
+        return false;
+    }
+
+    overlapped->listenSocket = listenSocket;
+    overlapped->acceptSocket = acceptSocket;
+
+    DWORD bytesReceived = 0;
+    BOOL result = acceptEx_(
+        listenSocket,               // 리슨 소켓
+        acceptSocket,               // 수락할 소켓
+        overlapped->buffer,         // 주소가 기록될 버퍼
+        0,                          // 첫 데이터는 받지 않음 (연결 즉시 완료)
+        ACCEPT_ADDRESS_SIZE,        // 로컬 주소 크기
+        ACCEPT_ADDRESS_SIZE,        // 원격 주소 크기
+        &bytesReceived,
+        overlapped                  // OVERLAPPED 구조체
+    );
+
+    if (!result) {
+        int error = WSAGetLastError();
+        if (error != ERROR_IO_PENDING) {
+            std::cerr << "AcceptEx failed: " << error << std::endl;
+            closesocket(acceptSocket);
+            overlapped->acceptSocket = INVALID_SOCKET;
+            return false;
+        }
+    }
+
+    return true;
+}
+
+void IOCPBackend::CompleteAccept(OverlappedEx* overlapped) {
+    // 리슨 소켓 속성을 상속시켜야 getpeername/shutdown 등이 동작함
+    setsockopt(overlapped->acceptSocket, SOL_SOCKET, SO_UPDATE_ACCEPT_CONTEXT,
+               reinterpret_cast<const char*>(&overlapped->listenSocket), sizeof(overlapped->listenSocket));
+
+    // 원격 주소를 버퍼 앞부분으로 옮겨 다른 백엔드와 같은 형태로 맞춤
+    sockaddr* localAddr = nullptr;
+    sockaddr* remoteAddr = nullptr;
+    int localLength = 0;
+    int remoteLength = 0;
+    getAcceptExSockaddrs_(overlapped->buffer, 0, ACCEPT_ADDRESS_SIZE, ACCEPT_ADDRESS_SIZE,
+                          &localAddr, &localLength, &remoteAddr, &remoteLength);
+
+    sockaddr_in clientAddr = {};
+    if (remoteAddr && remoteLength >= static_cast<int>(sizeof(sockaddr_in))) {
+        memcpy(&clientAddr, remoteAddr, sizeof(sockaddr_in));
+    }
+    memcpy(overlapped->buffer, &clientAddr, sizeof(sockaddr_in));
+}
+
+bool IOCPBackend::ReadOnDemand(IOCompletion& completion) {
+    OverlappedEx* posted = completion.overlapped;
+    SOCKET socket = posted->recvSocket;
+
+    // 0바이트 수신 완료 = 데이터 도착 통지, 이제서야 풀에서 버퍼를 붙여 읽음
+    OverlappedEx* buffered = IoContextPool::Acquire(IOOperation::RECV, SESSION_BUFFER_SIZE);
+    int received = recv(socket, buffered->buffer, static_cast<int>(buffered->bufferCapacity), 0);
+    if (received == SOCKET_ERROR) {
+        int error = WSAGetLastError();
+        IoContextPool::Release(buffered);
+
+        // 아직 읽을 데이터가 없으면 0바이트 수신을 다시 걸어둠
+        if (error == WSAEWOULDBLOCK) {
+            posted->Reset(IOOperation::RECV);
+            if (PostRecv(socket, posted)) return false;
+        } else {
+            std::cerr << "recv failed: " << error << " (소켓: " << socket << ")" << std::endl;
+        }
+        completion.success = false;
+        return true;
+    }
+
+    // 0 바이트는 상대방 종료 (ProcessRecv에서 처리)
+    buffered->recvSocket = socket;
+    IoContextPool::Release(posted);
+    completion.overlapped = buffered;
+    completion.bytesTransferred = static_cast<DWORD>(received);
+    return true;
+}
+
+bool IOCPBackend::GetCompletions(IOCompletion* completions, int maxCount, int& count, bool wait) {
+    maxCount = std::min<int>(std::max<int>(maxCount, 1), MAX_COMPLETION_BATCH);
+    count = 0;
+
+    // IOCP에서 완료된 소켓 I/O 작업을 한 번에 여러 개 가져오기
+    OVERLAPPED_ENTRY entries[MAX_COMPLETION_BATCH];
+    ULONG removed = 0;
+    BOOL result = GetQueuedCompletionStatusEx(
+        iocpHandle_,               // IOCP 핸들
+        entries,                   // 완료 목록
+        static_cast<ULONG>(maxCount),
+        &removed,                  // 가져온 개수
+        wait ? INFINITE : 0,       // 대기 시간 (무한대기, 바쁜 대기 모드는 바로 반환)
+        FALSE                      // alertable 대기 안 함
+    );
+    if (!result && !wait && GetLastError() == WAIT_TIMEOUT) {
+        return true; // 도착한 완료 없음
+    }
+    if (!result) {
+        std::cerr << "GetQueuedCompletionStatusEx failed: " << GetLastError() << std::endl;
+        return false;
+    }
+
+    int shutdownCount = 0;
+    for (ULONG i = 0; i < removed; ++i) {
+        OVERLAPPED_ENTRY& entry = entries[i];
+
+        if (entry.lpOverlapped == nullptr) {
+            // 깨우기 통지 (Wakeup에서 WAKEUP_KEY로 호출) - 완료 없이 반환되어 메일박스 확인
+            // 종료 신호 (PostShutdown에서 PostQueuedCompletionStatus(0, 0, nullptr) 호출)
+            if (entry.lpCompletionKey != WAKEUP_KEY) ++shutdownCount;
+            continue;
+        }
+
+        // Ex 버전은 항목별 성공 여부를 OVERLAPPED::Internal(NTSTATUS)로 알려줌
+        IOCompletion& completion = completions[count++];
+        completion.success = static_cast<LONG>(entry.lpOverlapped->Internal) >= 0;
+        completion.bytesTransferred = entry.dwNumberOfBytesTransferred;
+        completion.session = SessionHandle::FromKey(entry.lpCompletionKey);
+        completion.overlapped = static_cast<OverlappedEx*>(entry.lpOverlapped);
+
+        if (completion.success && completion.overlapped->operation == IOOperation::ACCEPT) {
+            CompleteAccept(completion.overlapped);
+        }
+
+        if (completion.success && completion.overlapped->operation == IOOperation::RECV &&
+            completion.overlapped->bufferCapacity == 0 && !ReadOnDemand(completion)) {
+            --count; // 수신을 다시 걸었으므로 전달하지 않음
+            continue;
+        }
+
+        if (!completion.success) {
+            std::cerr << "I/O operation failed: 0x" << std::hex << entry.lpOverlapped->Internal
+                      << std::dec << std::endl;
+        }
+    }
+
+    if (shutdownCount == 0) return true;
+
+    // 종료 신호는 워커마다 1개씩이므로 이 워커 몫 1개만 쓰고 나머지는 다시 넣음
+    // (함께 가져온 완료가 있으면 먼저 처리하도록 전부 다시 넣고, 다음 호출에서 종료)
+    int repost = (count > 0) ? shutdownCount : shutdownCount - 1;
+    for (int i = 0; i < repost; ++i) {
+        PostQueuedCompletionStatus(iocpHandle_, 0, 0, nullptr);
+    }
+    return count > 0;
+}
+
+void IOCPBackend::PostShutdown(int workerCount) {
+    if (!iocpHandle_) return;
+
+    for (int i = 0; i < workerCount; ++i) {
+        PostQueuedCompletionStatus(iocpHandle_, 0, 0, nullptr);
+    }
+}
+
+void IOCPBackend::Wakeup() {
+    if (!iocpHandle_) return;
+    PostQueuedCompletionStatus(iocpHandle_, 0, WAKEUP_KEY, nullptr);
+}
+
+#endif // _WIN32
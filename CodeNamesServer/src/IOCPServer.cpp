@@ -4,13 +4,23 @@
 #include "NetworkManager.h"
 #include "SessionManager.h"
 #include "GameManager.h"
+#include "ListenerHandoff.h"
+#include "PacketProtocol.h"
 #include <ctime>
+#include <chrono>
 
-IOCPServer::IOCPServer(int port) 
-    : port(port), isRunning(false)
+IOCPServer::IOCPServer(int port, IOBackendType backendType, int shardCount, int completionBatch)
+    : port(port), isRunning(false), backendType_(backendType), shardCount_(shardCount),
+      completionBatch_(completionBatch), maxClients_(MAX_CLIENTS), softClients_(0), busyPollUs_(0),
+      sessionPoolSize_(SESSION_POOL_SIZE), draining_(false), drainStop_(false), roomSequence_(0)
 {
 }
 
+void IOCPServer::SetConnectionLimits(int hardLimit, int softLimit) {
+    maxClients_ = hardLimit;
+    softClients_ = softLimit;
+}
+
 IOCPServer::~IOCPServer() {
     Stop();
 }
@@ -24,7 +34,20 @@ bool IOCPServer::Initialize() {
 
     sessionManager_ = std::make_unique<SessionManager>(this);
 
-    networkManager_ = std::make_unique<NetworkManager>(port, this);
+    // 이전 프로세스가 있으면 리슨 소켓을 넘겨받음 (없으면 새로 염)
+    std::vector<SOCKET> inheritedListenSockets;
+    if (!handoffPath_.empty()) {
+        handoff_ = std::make_unique<ListenerHandoff>(handoffPath_);
+        handoff_->Receive(inheritedListenSockets);
+    }
+
+    networkManager_ = std::make_unique<NetworkManager>(port, this, backendType_, shardCount_, completionBatch_,
+                                                       std::move(inheritedListenSockets));
+    networkManager_->SetBusyPoll(busyPollUs_);
+    networkManager_->SetUnixSocketPath(unixSocketPath_);
+    networkManager_->SetSessionPoolSize(static_cast<size_t>(sessionPoolSize_));
+    networkManager_->SetConnectionLimits(maxClients_,
+                                         softClients_ > 0 ? softClients_ : maxClients_ * SOFT_CLIENTS_PERCENT / 100);
     if (!networkManager_->Initialize()) {
         std::cerr << "NetworkManager 초기화 실패" << std::endl;
         return false;
@@ -37,14 +60,67 @@ void IOCPServer::Start() {
     if (isRunning) return;
     isRunning = true;
 
-    if (networkManager_) {
-        networkManager_->StartAccept();
+    if (!networkManager_ || !networkManager_->StartAccept()) return;
+
+    // 수락을 건 뒤에야 이전 프로세스에 알림 (그 전에 실패하면 이전 프로세스가 계속 수락)
+    if (handoff_) {
+        handoff_->Confirm();
+        handoff_->Serve([this]() { return networkManager_->GetListenSockets(); },
+                        [this]() { BeginDrain(); });
+    }
+}
+
+void IOCPServer::BeginDrain() {
+    networkManager_->StopAccepting();
+
+    {
+        std::lock_guard<std::mutex> lock(gamesMutex_);
+        draining_ = true;
+        drainThread_ = std::thread(&IOCPServer::DrainThread, this);
+    }
+
+    // 이후 BuildGameRoom은 draining_을 보고 거절하고, 이미 만든 방의 플레이어는 IN_GAME이므로 그대로 남음
+    if (sessionManager_) {
+        sessionManager_->BeginDrain();
     }
 }
 
+void IOCPServer::DrainThread() {
+    // 게임방은 끝나도 목록에서 빠지지 않으므로 끝났는지 (승패 결정 / 플레이어 전원 이탈) 주기적으로 확인
+    std::unique_lock<std::mutex> lock(gamesMutex_);
+    while (!drainStop_) {
+        size_t running = 0;
+        for (auto& game : activeGames_) {
+            if (!game.second->IsFinished()) ++running;
+        }
+        if (running == 0) break;
+
+        std::cout << "Draining: " << running << " games in progress" << std::endl;
+        drainCv_.wait_for(lock, std::chrono::milliseconds(DRAIN_CHECK_MS));
+    }
+    if (drainStop_) return;
+    lock.unlock();
+
+    std::cout << "All games finished after handoff" << std::endl;
+    if (onDrained_) onDrained_();
+}
+
 void IOCPServer::Stop() {
     if (!isRunning) return;
     isRunning = false;   
+
+    // 종료 중에 리슨 소켓을 넘겨주지 않도록 먼저 멈춤
+    if (handoff_) {
+        handoff_->Stop();
+    }
+    {
+        std::lock_guard<std::mutex> lock(gamesMutex_);
+        drainStop_ = true;
+    }
+    drainCv_.notify_all();
+    if (drainThread_.joinable()) {
+        drainThread_.join();
+    }
     
     if (networkManager_) {
         networkManager_->Shutdown();
@@ -65,17 +141,25 @@ void IOCPServer::Stop() {
 }
 
 // 세션 제거 요청을 SessionManager에 전달
-void IOCPServer::RemoveSession(SOCKET socket) {
+void IOCPServer::RemoveSession(SessionHandle handle) {
     if (sessionManager_) {
-        sessionManager_->RemoveSession(socket);
+        sessionManager_->RemoveSession(handle);
     }
 }
 
+size_t IOCPServer::GetSessionCount() const {
+    return sessionManager_ ? sessionManager_->GetSessionCount() : 0;
+}
+
+SessionSlotMap* IOCPServer::GetSessionSlots() {
+    return sessionManager_ ? &sessionManager_->GetSessionSlots() : nullptr;
+}
+
 // 세션 추가 요청을 SessionManager에 전달  
 bool IOCPServer::AddSession(std::shared_ptr<Session> session) {
-    if (sessionManager_) {
-        sessionManager_->AddSession(session);
-    } else return false;
+    if (!sessionManager_ || !sessionManager_->AddSession(session)) {
+        return false;
+    }
     
     // 세션에 Server 참조 설정 (전역 매니저들 접근용)
     session->SetServer(this);
@@ -89,27 +173,34 @@ void IOCPServer::CreateGameRoom(const std::vector<std::shared_ptr<Session>>& pla
         return;
     }
 
-    std::string roomId = "room_" + std::to_string(std::time(nullptr));
-    auto gameManager = std::make_unique<GameManager>(roomId);
+    // 게임방마다 소유 샤드를 정하고 그 샤드에서 생성 (공유 워커 모드는 호출한 스레드에서 바로 진행)
+    if (!networkManager_) return;
+    int shardIndex = networkManager_->NextShard();
+    networkManager_->RunOnShard(shardIndex, [this, players, shardIndex]() {
+        BuildGameRoom(players, shardIndex);
+    });
+}
+
+void IOCPServer::BuildGameRoom(const std::vector<std::shared_ptr<Session>>& players, int shardIndex) {
+    std::string roomId = "room_" + std::to_string(std::time(nullptr)) + "_" + std::to_string(roomSequence_++);
+    auto gameManager = std::make_unique<GameManager>(roomId, GetSessionSlots());
+    gameManager->SetShardIndex(shardIndex);
+    GameManager* gmPtr = gameManager.get();
+    bool inserted = false;  // 이 호출이 activeGames_에 넣었을 때만 롤백에서 제거
+    bool draining = false;
 
     try {
         std::cout << "게임 룸 생성 시작" << std::endl;
 
-        // Insert game manager into active map
+        // 방 등록과 플레이어 배정을 한 번에 (BeginDrain이 그 사이에 로비 세션으로 보고 내보내지 않도록)
         {
             std::lock_guard<std::mutex> lock(gamesMutex_);
-            activeGames_[roomId] = std::move(gameManager);
+            // 리슨 소켓을 넘겨준 프로세스는 진행 중인 게임만 마무리 (새 게임은 새 프로세스에서)
+            draining = draining_;
+            if (draining) throw std::runtime_error("server is draining");
+            inserted = activeGames_.emplace(roomId, std::move(gameManager)).second;
+            if (!inserted) throw std::runtime_error("duplicate room id");
             std::cout << "[IOCPServer] activeGames_ inserted roomId=" << roomId << std::endl;
-        }
-
-        GameManager* gmPtr = nullptr;
-        try {
-            {
-                std::lock_guard<std::mutex> lock(gamesMutex_);
-                auto it = activeGames_.find(roomId);
-                if (it == activeGames_.end()) throw std::runtime_error("Insert failed");
-                gmPtr = it->second.get();
-            }
 
             std::cout << "[IOCPServer] Adding players to GameManager: count=" << players.size() << std::endl;
             for (auto& session : players) {
@@ -122,53 +213,45 @@ void IOCPServer::CreateGameRoom(const std::vector<std::shared_ptr<Session>>& pla
                     std::cout << "플레이어 게임 추가: " << session->GetNickname() << std::endl;
                 }
             }
+        }
 
-            // 게임 시작
-            std::cout << "[IOCPServer] Calling StartGame for room=" << roomId << std::endl;
-            bool started = false;
-            try {
-                started = gmPtr->StartGame();
-            } catch (const std::exception& e) {
-                std::cerr << "[IOCPServer] StartGame threw exception: " << e.what() << std::endl;
-                throw; // rethrow to outer catch
-            }
+        // 게임 시작
+        std::cout << "[IOCPServer] Calling StartGame for room=" << roomId << std::endl;
+        bool started = false;
+        try {
+            started = gmPtr->StartGame();
+        } catch (const std::exception& e) {
+            std::cerr << "[IOCPServer] StartGame threw exception: " << e.what() << std::endl;
+            throw; // rethrow to outer catch
+        }
 
-            if (started) {
-                std::cout << "게임 시작 완료: " << roomId << std::endl;
-            } else {
-                std::cerr << "[IOCPServer] StartGame returned false for room=" << roomId << std::endl;
-                throw std::runtime_error("StartGame returned false");
-            }
-        } catch (...) {
-            // ensure we remove the partially-created game if any
-            std::lock_guard<std::mutex> lock(gamesMutex_);
-            auto it = activeGames_.find(roomId);
-            if (it != activeGames_.end()) {
-                activeGames_.erase(it);
-                std::cerr << "[IOCPServer] Removed partial game room: " << roomId << std::endl;
-            }
-            throw; // allow outer handler to manage notification
+        if (started) {
+            std::cout << "게임 시작 완료: " << roomId << std::endl;
+        } else {
+            std::cerr << "[IOCPServer] StartGame returned false for room=" << roomId << std::endl;
+            throw std::runtime_error("StartGame returned false");
         }
-        
     } catch (const std::exception& e) {
         std::cerr << "게임 룸 생성 오류: " << e.what() << std::endl;
         
-        // 롤백: activeGames_에 추가된 항목이 있다면 제거
-        {
+        // 롤백: 이 호출이 넣은 방만 제거 (같은 이름의 다른 방은 건드리지 않음)
+        if (inserted) {
             std::lock_guard<std::mutex> lock(gamesMutex_);
-            auto it = activeGames_.find(roomId);
-            if (it != activeGames_.end()) {
-                activeGames_.erase(it);
-            }
+            activeGames_.erase(roomId);
+            std::cerr << "[IOCPServer] Removed partial game room: " << roomId << std::endl;
         }
 
-        // 오류 발생 시 플레이어들을 로비로 되돌림
+        // 오류 발생 시 플레이어들을 로비로 되돌림 (드레인 중이면 새 프로세스로 재접속 안내)
         for (auto& session : players) {
             if (session && !session->IsClosed()) {
                 session->SetState(SessionState::IN_LOBBY);
                 session->SetGameManager(nullptr);
                 session->SetInMatchingQueue(false);
-                session->PostSend("GAME_CREATE_ERROR");
+                if (draining) {
+                    session->CloseAfterSend(PKT_SERVER_BUSY);
+                } else {
+                    session->PostSend(PKT_GAME_CREATE_ERROR);
+                }
             }
         }
     }
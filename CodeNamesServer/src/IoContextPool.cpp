@@ -0,0 +1,132 @@
+#include "IoContextPool.h"
+#include "Session.h"
+#include <algorithm>
+#include <iostream>
+#include <mutex>
+#include <new>
+#include <vector>
+
+static_assert(IoContextPool::LARGE_BUFFER_SIZE == SESSION_BUFFER_SIZE,
+              "수신 컨텍스트는 세션 버퍼 크기와 같아야 함");
+
+std::atomic<uint64_t> IoContextPool::heapAllocCount_(0);
+std::atomic<uint64_t> IoContextPool::reuseCount_(0);
+std::atomic<int64_t> IoContextPool::inUseBytes_(0);
+
+namespace {
+    constexpr int CLASS_COUNT = 3;
+    constexpr int NO_BUFFER_CLASS = 2;
+    constexpr size_t GLOBAL_LIMIT = 8192; // 클래스별 전역 보관 상한 (초과분은 해제)
+
+    size_t ClassBufferSize(int sizeClass) {
+        if (sizeClass == NO_BUFFER_CLASS) return 0;
+        return sizeClass == 0 ? IoContextPool::SMALL_BUFFER_SIZE : IoContextPool::LARGE_BUFFER_SIZE;
+    }
+
+    int64_t ContextBytes(int sizeClass) {
+        return static_cast<int64_t>(sizeof(OverlappedEx) + ClassBufferSize(sizeClass));
+    }
+
+    void Destroy(OverlappedEx* overlapped) {
+        overlapped->~OverlappedEx();
+        ::operator delete(overlapped);
+    }
+
+    struct GlobalFreeList {
+        std::mutex lock;
+        std::vector<OverlappedEx*> items;
+
+        ~GlobalFreeList() {
+            for (auto* overlapped : items) Destroy(overlapped);
+        }
+    };
+
+    GlobalFreeList g_globalLists[CLASS_COUNT];
+
+    // 스레드 종료 시 남은 컨텍스트는 전역 리스트로 돌려보냄
+    struct ThreadCache {
+        std::vector<OverlappedEx*> items[CLASS_COUNT];
+
+        ~ThreadCache() {
+            for (int i = 0; i < CLASS_COUNT; ++i) {
+                std::lock_guard<std::mutex> lock(g_globalLists[i].lock);
+                auto& global = g_globalLists[i].items;
+                global.insert(global.end(), items[i].begin(), items[i].end());
+            }
+        }
+    };
+
+    thread_local ThreadCache t_cache;
+}
+
+OverlappedEx* IoContextPool::Acquire(IOOperation operation, size_t bufferSize) {
+    if (bufferSize > LARGE_BUFFER_SIZE) {
+        std::cerr << "IoContextPool: 요청 버퍼가 너무 큽니다 (" << bufferSize << " bytes)" << std::endl;
+        return nullptr;
+    }
+
+    int sizeClass = (bufferSize == 0) ? NO_BUFFER_CLASS : (bufferSize <= SMALL_BUFFER_SIZE) ? 0 : 1;
+    auto& cache = t_cache.items[sizeClass];
+
+    // 스레드 캐시가 비었으면 전역 리스트에서 한 묶음 가져옴
+    if (cache.empty()) {
+        auto& global = g_globalLists[sizeClass];
+        std::lock_guard<std::mutex> lock(global.lock);
+        size_t count = std::min<size_t>(GLOBAL_BATCH, global.items.size());
+        cache.insert(cache.end(), global.items.end() - count, global.items.end());
+        global.items.resize(global.items.size() - count);
+    }
+
+    OverlappedEx* overlapped;
+    if (!cache.empty()) {
+        overlapped = cache.back();
+        cache.pop_back();
+        overlapped->Reset(operation);
+        reuseCount_.fetch_add(1, std::memory_order_relaxed);
+    } else {
+        // 컨텍스트와 버퍼를 한 번에 할당 (버퍼는 구조체 바로 뒤)
+        size_t capacity = ClassBufferSize(sizeClass);
+        void* memory = ::operator new(sizeof(OverlappedEx) + capacity);
+        char* buffer = static_cast<char*>(memory) + sizeof(OverlappedEx);
+        overlapped = new (memory) OverlappedEx(operation, buffer, static_cast<ULONG>(capacity),
+                                               static_cast<uint8_t>(sizeClass));
+        heapAllocCount_.fetch_add(1, std::memory_order_relaxed);
+    }
+    inUseBytes_.fetch_add(ContextBytes(sizeClass), std::memory_order_relaxed);
+    return overlapped;
+}
+
+OverlappedEx* IoContextPool::AttachBuffer(OverlappedEx* overlapped, size_t bufferSize) {
+    if (overlapped->bufferCapacity >= bufferSize) return overlapped;
+
+    OverlappedEx* buffered = Acquire(overlapped->operation, bufferSize);
+    if (!buffered) return nullptr;
+
+    Release(overlapped);
+    return buffered;
+}
+
+void IoContextPool::Release(OverlappedEx* overlapped) {
+    if (!overlapped) return;
+    inUseBytes_.fetch_sub(ContextBytes(overlapped->sizeClass), std::memory_order_relaxed);
+
+    // 송신 데이터는 바로 놓아줌 (vector 용량은 재사용)
+    overlapped->sendPayloads.clear();
+
+    auto& cache = t_cache.items[overlapped->sizeClass];
+    cache.push_back(overlapped);
+    if (cache.size() <= THREAD_CACHE_LIMIT) return;
+
+    // 스레드 캐시가 넘치면 한 묶음을 전역 리스트로 이동
+    auto& global = g_globalLists[overlapped->sizeClass];
+    std::lock_guard<std::mutex> lock(global.lock);
+    for (size_t i = 0; i < GLOBAL_BATCH; ++i) {
+        OverlappedEx* item = cache.back();
+        cache.pop_back();
+        if (global.items.size() < GLOBAL_LIMIT) {
+            global.items.push_back(item);
+        } else {
+            Destroy(item);
+        }
+    }
+}
@@ -0,0 +1,989 @@
+#ifdef __linux__
+
+#include "IoUringBackend.h"
+#include "Session.h"
+#include "IoContextPool.h"
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <sys/uio.h>
+#include <algorithm>
+#include <iostream>
+
+namespace {
+    // 요청 객체가 아닌 SQE를 구분하기 위한 user_data 값
+    constexpr uint64_t WAKEUP_TAG = 1;
+    constexpr uint64_t CANCEL_TAG = 2;
+    constexpr uint64_t PROVIDE_TAG = 3;
+    constexpr uint16_t RECV_BUFFER_GROUP = 0;
+
+    // 워커 스레드에서 만든 SQE는 다음 대기 때 모아서 제출
+    // (샤드 모드에서는 링이 여러 개이므로 이 스레드가 대기하는 링을 기억 - 다른 링에 넣은 SQE는 바로 제출)
+    thread_local const IoUringBackend* t_workerBackend = nullptr;
+
+    int IoUringSetup(unsigned entries, io_uring_params* params) {
+        return static_cast<int>(syscall(__NR_io_uring_setup, entries, params));
+    }
+
+    int IoUringEnter(int ringFd, unsigned toSubmit, unsigned minComplete, unsigned flags) {
+        return static_cast<int>(syscall(__NR_io_uring_enter, ringFd, toSubmit, minComplete, flags, nullptr, 0));
+    }
+
+    int IoUringRegister(int ringFd, unsigned opcode, void* arg, unsigned count) {
+        return static_cast<int>(syscall(__NR_io_uring_register, ringFd, opcode, arg, count));
+    }
+}
+
+IoUringBackend::IoUringBackend()
+    : ringFd_(-1), sqRingPtr_(nullptr), sqRingSize_(0), cqRingPtr_(nullptr), cqRingSize_(0),
+      sqes_(nullptr), sqesSize_(0), sqHead_(nullptr), sqTail_(nullptr), sqMask_(0), sqEntries_(0),
+      sqArray_(nullptr), cqHead_(nullptr), cqTail_(nullptr), cqMask_(0), cqes_(nullptr),
+      pendingSubmit_(0), shuttingDown_(false), notified_(false),
+      recvBuffers_(nullptr), recvBuffersReturned_(false) {
+}
+
+IoUringBackend::~IoUringBackend() {
+    for (auto& completion : completions_) {
+        IoContextPool::Release(completion.overlapped);
+    }
+    completions_.clear();
+
+    for (auto& pair : contexts_) {
+        auto& context = pair.second;
+        IoContextPool::Release(context->postedRecv);
+        for (auto* overlapped : context->pendingSends) {
+            IoContextPool::Release(overlapped);
+        }
+        for (auto* overlapped : context->postedAccepts) {
+            IoContextPool::Release(overlapped);
+        }
+        for (SOCKET acceptSocket : context->acceptBacklog) {
+            closesocket(acceptSocket);
+        }
+    }
+
+    // 링을 닫으면 커널이 남은 요청을 모두 정리한다
+    if (ringFd_ != -1) close(ringFd_);
+
+    // 완료를 받지 못한 요청은 컨텍스트를 붙잡고 있으므로 직접 해제 (워커가 먼저 멈춘 경우)
+    std::vector<std::shared_ptr<SocketContext>> remaining;
+    for (auto& pair : contexts_) {
+        remaining.push_back(pair.second);
+    }
+    contexts_.clear();
+    for (auto& weak : closing_) {
+        if (auto context = weak.lock()) remaining.push_back(std::move(context));
+    }
+    closing_.clear();
+    for (auto& context : remaining) {
+        ReleaseRequests(*context);
+    }
+
+    if (sqes_) munmap(sqes_, sqesSize_);
+    if (cqRingPtr_ && cqRingPtr_ != sqRingPtr_) munmap(cqRingPtr_, cqRingSize_);
+    if (sqRingPtr_) munmap(sqRingPtr_, sqRingSize_);
+
+    if (recvBuffers_) munmap(recvBuffers_, static_cast<size_t>(RECV_BUFFER_COUNT) * RECV_BUFFER_SIZE);
+}
+
+bool IoUringBackend::Create() {
+    if (!SetupRing()) return false;
+
+    // multishot recv는 provided buffer가 필수 (커널 6.0 이상)
+    if (!SetupRecvBuffers()) return false;
+
+    // 파일 등록은 실패해도 일반 fd로 동작
+    SetupFixedFiles();
+
+    std::cout << "io_uring created successfully (sq=" << sqEntries_
+              << ", recv buffers=" << RECV_BUFFER_COUNT << "x" << RECV_BUFFER_SIZE
+              << ", fixed files=" << freeFileSlots_.size() << ")" << std::endl;
+    return true;
+}
+
+bool IoUringBackend::SetupRing() {
+    io_uring_params params = {};
+    ringFd_ = IoUringSetup(RING_ENTRIES, &params);
+    if (ringFd_ < 0) {
+        std::cerr << "io_uring_setup failed: " << errno << std::endl;
+        ringFd_ = -1;
+        return false;
+    }
+
+    sqRingSize_ = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+    cqRingSize_ = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+    bool singleMmap = (params.features & IORING_FEAT_SINGLE_MMAP) != 0;
+    if (singleMmap) {
+        sqRingSize_ = cqRingSize_ = std::max(sqRingSize_, cqRingSize_);
+    }
+
+    sqRingPtr_ = mmap(nullptr, sqRingSize_, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+                      ringFd_, IORING_OFF_SQ_RING);
+    if (sqRingPtr_ == MAP_FAILED) {
+        sqRingPtr_ = nullptr;
+        std::cerr << "mmap (sq ring) failed: " << errno << std::endl;
+        return false;
+    }
+
+    if (singleMmap) {
+        cqRingPtr_ = sqRingPtr_;
+    } else {
+        cqRingPtr_ = mmap(nullptr, cqRingSize_, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+                          ringFd_, IORING_OFF_CQ_RING);
+        if (cqRingPtr_ == MAP_FAILED) {
+            cqRingPtr_ = nullptr;
+            std::cerr << "mmap (cq ring) failed: " << errno << std::endl;
+            return false;
+        }
+    }
+
+    sqesSize_ = params.sq_entries * sizeof(io_uring_sqe);
+    void* sqes = mmap(nullptr, sqesSize_, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+                      ringFd_, IORING_OFF_SQES);
+    if (sqes == MAP_FAILED) {
+        std::cerr << "mmap (sqes) failed: " << errno << std::endl;
+        return false;
+    }
+    sqes_ = static_cast<io_uring_sqe*>(sqes);
+
+    char* sq = static_cast<char*>(sqRingPtr_);
+    sqHead_ = reinterpret_cast<unsigned*>(sq + params.sq_off.head);
+    sqTail_ = reinterpret_cast<unsigned*>(sq + params.sq_off.tail);
+    sqMask_ = *reinterpret_cast<unsigned*>(sq + params.sq_off.ring_mask);
+    sqEntries_ = *reinterpret_cast<unsigned*>(sq + params.sq_off.ring_entries);
+    sqArray_ = reinterpret_cast<unsigned*>(sq + params.sq_off.array);
+
+    char* cq = static_cast<char*>(cqRingPtr_);
+    cqHead_ = reinterpret_cast<unsigned*>(cq + params.cq_off.head);
+    cqTail_ = reinterpret_cast<unsigned*>(cq + params.cq_off.tail);
+    cqMask_ = *reinterpret_cast<unsigned*>(cq + params.cq_off.ring_mask);
+    cqes_ = reinterpret_cast<io_uring_cqe*>(cq + params.cq_off.cqes);
+
+    return true;
+}
+
+bool IoUringBackend::SetupRecvBuffers() {
+    size_t buffersSize = static_cast<size_t>(RECV_BUFFER_COUNT) * RECV_BUFFER_SIZE;
+    void* buffers = mmap(nullptr, buffersSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (buffers == MAP_FAILED) {
+        std::cerr << "mmap (recv buffers) failed: " << errno << std::endl;
+        return false;
+    }
+    recvBuffers_ = static_cast<char*>(buffers);
+
+    // 전체 버퍼를 한 번에 등록하고 완료까지 기다림 (이후 recv가 바로 버퍼를 고를 수 있도록)
+    {
+        std::lock_guard<std::mutex> lock(sqMutex_);
+        io_uring_sqe* sqe = AcquireSqe();
+        if (!sqe) return false;
+        sqe->opcode = IORING_OP_PROVIDE_BUFFERS;
+        sqe->fd = static_cast<int>(RECV_BUFFER_COUNT);
+        sqe->addr = reinterpret_cast<uint64_t>(recvBuffers_);
+        sqe->len = RECV_BUFFER_SIZE;
+        sqe->off = 0;
+        sqe->buf_group = RECV_BUFFER_GROUP;
+        sqe->user_data = PROVIDE_TAG;
+        CommitSqe();
+    }
+
+    if (SubmitAndWait(1) < 0) {
+        std::cerr << "io_uring_enter (provide buffers) failed: " << errno << std::endl;
+        return false;
+    }
+
+    io_uring_cqe cqe;
+    if (!ReapCqe(cqe) || cqe.user_data != PROVIDE_TAG || cqe.res < 0) {
+        std::cerr << "IORING_OP_PROVIDE_BUFFERS failed" << std::endl;
+        return false;
+    }
+    return true;
+}
+
+bool IoUringBackend::SetupFixedFiles() {
+    // 빈 테이블만 등록해두고 소켓이 연결될 때마다 슬롯을 채움
+    io_uring_rsrc_register reg = {};
+    reg.nr = FIXED_FILE_COUNT;
+    reg.flags = IORING_RSRC_REGISTER_SPARSE;
+    if (IoUringRegister(ringFd_, IORING_REGISTER_FILES2, &reg, sizeof(reg)) < 0) {
+        std::cerr << "io_uring_register (FILES2) failed: " << errno << " - 일반 fd로 동작" << std::endl;
+        return false;
+    }
+
+    freeFileSlots_.reserve(FIXED_FILE_COUNT);
+    for (int i = static_cast<int>(FIXED_FILE_COUNT) - 1; i >= 0; --i) {
+        freeFileSlots_.push_back(i);
+    }
+    return true;
+}
+
+bool IoUringBackend::Associate(SOCKET socket, SessionHandle session) {
+    auto context = std::make_shared<SocketContext>();
+    context->backend = this;
+    context->socket = socket;
+    context->fileIndex = AcquireFileSlot(socket);
+    context->session = session;
+
+    std::lock_guard<std::mutex> lock(contextsMutex_);
+    contexts_[socket] = context;
+    return true;
+}
+
+void IoUringBackend::Dissociate(SOCKET socket) {
+    std::shared_ptr<SocketContext> context;
+    {
+        std::lock_guard<std::mutex> lock(contextsMutex_);
+        auto it = contexts_.find(socket);
+        if (it == contexts_.end()) return;
+        context = std::move(it->second);
+        contexts_.erase(it);
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(context->lock);
+        context->closed = true;
+
+        IoContextPool::Release(context->postedRecv);
+        context->postedRecv = nullptr;
+        for (auto& chunk : context->backlog) {
+            ReturnRecvBuffer(chunk.bufferId);
+        }
+        context->backlog.clear();
+        for (auto* overlapped : context->pendingSends) {
+            IoContextPool::Release(overlapped);
+        }
+        context->pendingSends.clear();
+        for (auto* overlapped : context->postedAccepts) {
+            IoContextPool::Release(overlapped);
+        }
+        context->postedAccepts.clear();
+        for (SOCKET acceptSocket : context->acceptBacklog) {
+            closesocket(acceptSocket);
+        }
+        context->acceptBacklog.clear();
+
+        // 커널이 파일 참조를 들고 있으므로 close 전에 multishot recv를 취소해야 소켓이 실제로 닫힘
+        // (전송 중인 송신은 완료 시 HandleSendCqe에서 정리)
+        if (context->recvRequest && !context->cancelRequested) {
+            QueueCancel(context->recvRequest);
+            context->cancelRequested = true;
+        }
+
+        if (context->acceptRequest && !context->acceptCancelRequested) {
+            QueueCancel(context->acceptRequest);
+            context->acceptCancelRequested = true;
+        }
+
+        // 테이블도 파일 참조를 들고 있으므로 비움 (슬롯 재사용은 컨텍스트 소멸 시)
+        if (context->fileIndex >= 0) {
+            int emptyFd = -1;
+            io_uring_files_update update = {};
+            update.offset = static_cast<uint32_t>(context->fileIndex);
+            update.fds = reinterpret_cast<uint64_t>(&emptyFd);
+            IoUringRegister(ringFd_, IORING_REGISTER_FILES_UPDATE, &update, 1);
+        }
+    }
+
+    // 취소 완료 전에 워커가 멈추면 요청이 컨텍스트를 붙잡은 채 남으므로 소멸 시 찾을 수 있게 기록
+    {
+        std::lock_guard<std::mutex> lock(closingMutex_);
+        closing_.erase(std::remove_if(closing_.begin(), closing_.end(),
+                                      [](const std::weak_ptr<SocketContext>& weak) { return weak.expired(); }),
+                       closing_.end());
+        closing_.push_back(context);
+    }
+
+    // 아직 워커가 가져가지 않은 완료는 세션이 사라지기 전에 버림
+    // (리슨 소켓의 accept 완료는 워커가 받아서 새 소켓을 정리해야 하므로 남겨둠)
+    if (context->session.IsValid()) {
+        std::lock_guard<std::mutex> lock(completionMutex_);
+        for (auto it = completions_.begin(); it != completions_.end();) {
+            if (it->session == context->session) {
+                IoContextPool::Release(it->overlapped);
+                it = completions_.erase(it);
+            } else {
+                ++it;
+            }
+        }
+    }
+
+    SubmitIfNotWorker();
+}
+
+void IoUringBackend::ReleaseRequests(SocketContext& context) {
+    Request* recvRequest = context.recvRequest;
+    Request* sendRequest = context.sendRequest;
+    Request* acceptRequest = context.acceptRequest;
+    context.recvRequest = context.sendRequest = context.acceptRequest = nullptr;
+
+    // 요청이 컨텍스트의 마지막 참조일 수 있으므로 컨텍스트 멤버는 먼저 정리하고 삭제
+    if (sendRequest) IoContextPool::Release(sendRequest->overlapped);
+    delete recvRequest;
+    delete sendRequest;
+    delete acceptRequest;
+}
+
+std::shared_ptr<IoUringBackend::SocketContext> IoUringBackend::FindContext(SOCKET socket) {
+    std::lock_guard<std::mutex> lock(contextsMutex_);
+    auto it = contexts_.find(socket);
+    return (it != contexts_.end()) ? it->second : nullptr;
+}
+
+bool IoUringBackend::PostRecv(SOCKET socket, OverlappedEx* overlapped) {
+    auto context = FindContext(socket);
+    if (!context) return false;
+
+    std::deque<IOCompletion> completed;
+    {
+        std::lock_guard<std::mutex> lock(context->lock);
+        if (context->closed) return false;
+        if (context->postedRecv) {
+            std::cerr << "PostRecv: 이미 대기 중인 수신이 있습니다 (소켓: " << socket << ")" << std::endl;
+            return false;
+        }
+
+        // 이미 도착해 있는 데이터가 있으면 바로 완료, 없으면 multishot recv가 채워줄 때까지 대기
+        context->postedRecv = overlapped;
+        DeliverRecv(*context, completed);
+        MaybeArmRecv(*context);
+    }
+
+    if (!completed.empty()) {
+        PushCompletions(completed);
+        if (t_workerBackend != this) {
+            std::lock_guard<std::mutex> lock(sqMutex_);
+            QueueNop(); // 대기 중인 워커를 깨움
+        }
+    }
+    RearmStarved();
+    SubmitIfNotWorker();
+    return true;
+}
+
+bool IoUringBackend::PostSend(SOCKET socket, OverlappedEx* overlapped) {
+    auto context = FindContext(socket);
+    if (!context) return false;
+
+    {
+        std::lock_guard<std::mutex> lock(context->lock);
+        if (context->closed) return false;
+
+        // 소켓당 송신은 1개씩만 커널에 넘겨 순서를 보장
+        context->pendingSends.push_back(overlapped);
+        StartNextSend(*context);
+    }
+
+    SubmitIfNotWorker();
+    return true;
+}
+
+bool IoUringBackend::PostAccept(SOCKET listenSocket, OverlappedEx* overlapped) {
+    auto context = FindContext(listenSocket);
+    if (!context) return false;
+
+    std::deque<IOCompletion> completed;
+    {
+        std::lock_guard<std::mutex> lock(context->lock);
+        if (context->closed) return false;
+
+        // 이미 수락된 소켓이 있으면 바로 완료, 없으면 multishot accept가 채워줄 때까지 대기
+        overlapped->listenSocket = listenSocket;
+        context->postedAccepts.push_back(overlapped);
+        DeliverAccepts(*context, completed);
+
+        if (t_workerBackend == this) {
+            MaybeArmAccept(*context);
+        } else {
+            std::lock_guard<std::mutex> deferredLock(deferredAcceptMutex_);
+            deferredAccepts_.push_back(context);
+            std::lock_guard<std::mutex> sqLock(sqMutex_);
+            QueueNop(); // 대기 중인 워커를 깨워 무장시킴
+        }
+    }
+
+    if (!completed.empty()) {
+        PushCompletions(completed);
+        if (t_workerBackend != this) {
+            std::lock_guard<std::mutex> lock(sqMutex_);
+            QueueNop(); // 대기 중인 워커를 깨움
+        }
+    }
+    SubmitIfNotWorker();
+    return true;
+}
+
+void IoUringBackend::MaybeArmAccept(SocketContext& context) {
+    if (context.closed || context.acceptRequest || context.acceptFailed) return;
+    if (context.acceptBacklog.size() >= MAX_ACCEPT_BACKLOG) return; // 워커가 따라잡을 때까지 보류
+
+    context.acceptRequest = new Request{ RequestKind::ACCEPT, context.shared_from_this() };
+    QueueAccept(context);
+}
+
+void IoUringBackend::ArmDeferredAccepts() {
+    std::vector<std::weak_ptr<SocketContext>> deferred;
+    {
+        std::lock_guard<std::mutex> lock(deferredAcceptMutex_);
+        if (deferredAccepts_.empty()) return;
+        deferred.swap(deferredAccepts_);
+    }
+
+    for (auto& weak : deferred) {
+        if (auto context = weak.lock()) {
+            std::lock_guard<std::mutex> lock(context->lock);
+            MaybeArmAccept(*context);
+        }
+    }
+}
+
+void IoUringBackend::DeliverAccepts(SocketContext& context, std::deque<IOCompletion>& completed) {
+    while (!context.postedAccepts.empty() && !context.acceptBacklog.empty()) {
+        OverlappedEx* overlapped = context.postedAccepts.front();
+        context.postedAccepts.pop_front();
+        overlapped->acceptSocket = context.acceptBacklog.front();
+        context.acceptBacklog.pop_front();
+
+        // multishot은 주소 버퍼를 매번 덮어쓰므로 상대 주소는 전달 시점에 조회
+        socklen_t addrLength = sizeof(sockaddr_in);
+        if (getpeername(overlapped->acceptSocket, reinterpret_cast<sockaddr*>(overlapped->buffer),
+                        &addrLength) != 0) {
+            memset(overlapped->buffer, 0, sizeof(sockaddr_in));
+        }
+        completed.push_back({ true, 0, SessionHandle(), overlapped });
+    }
+
+    if (context.acceptFailed && context.acceptBacklog.empty() && !context.postedAccepts.empty()) {
+        OverlappedEx* overlapped = context.postedAccepts.front();
+        context.postedAccepts.pop_front();
+        completed.push_back({ false, 0, SessionHandle(), overlapped });
+        context.acceptFailed = false; // NetworkManager가 다시 PostAccept하면 재무장
+    }
+}
+
+void IoUringBackend::MaybeArmRecv(SocketContext& context) {
+    if (context.closed || context.recvRequest || context.eof || context.failed || context.starved) return;
+    if (context.backlog.size() >= MAX_RECV_BACKLOG) return; // 세션이 따라잡을 때까지 보류
+
+    auto* request = new Request{ RequestKind::RECV, context.shared_from_this() };
+    context.recvRequest = request;
+    QueueRecv(context);
+}
+
+void IoUringBackend::DeliverRecv(SocketContext& context, std::deque<IOCompletion>& completed) {
+    OverlappedEx* overlapped = context.postedRecv;
+    if (!overlapped) return;
+
+    if (!context.backlog.empty()) {
+        // 쌓인 버퍼를 세션 버퍼 크기만큼 이어붙여 한 번에 전달
+        overlapped = IoContextPool::AttachBuffer(overlapped, SESSION_BUFFER_SIZE);
+        context.postedRecv = overlapped;
+        size_t capacity = overlapped->wsaBuf.len;
+        size_t copied = 0;
+        while (!context.backlog.empty() && copied < capacity) {
+            RecvChunk& chunk = context.backlog.front();
+            size_t count = std::min<size_t>(chunk.length - chunk.offset, capacity - copied);
+            memcpy(overlapped->wsaBuf.buf + copied, RecvBufferAddress(chunk.bufferId) + chunk.offset, count);
+            copied += count;
+            chunk.offset += static_cast<uint32_t>(count);
+            if (chunk.offset == chunk.length) {
+                ReturnRecvBuffer(chunk.bufferId);
+                context.backlog.pop_front();
+            }
+        }
+        completed.push_back({ true, static_cast<DWORD>(copied), context.session, overlapped });
+    } else if (context.eof) {
+        // 0 바이트 완료 = 상대방 종료 (IOCP와 동일)
+        completed.push_back({ true, 0, context.session, overlapped });
+    } else if (context.failed) {
+        completed.push_back({ false, 0, context.session, overlapped });
+    } else {
+        return;
+    }
+
+    context.postedRecv = nullptr;
+}
+
+void IoUringBackend::StartNextSend(SocketContext& context) {
+    if (context.sendRequest || context.pendingSends.empty()) return;
+
+    OverlappedEx* overlapped = context.pendingSends.front();
+    context.pendingSends.pop_front();
+
+    auto* request = new Request{ RequestKind::SEND, context.shared_from_this(), overlapped };
+
+    context.sendRequest = request;
+    QueueSend(context, request);
+}
+
+io_uring_sqe* IoUringBackend::AcquireSqe() {
+    unsigned head = __atomic_load_n(sqHead_, __ATOMIC_ACQUIRE);
+    unsigned tail = *sqTail_;
+
+    if (tail - head >= sqEntries_) {
+        // SQ가 가득 찼으면 쌓인 SQE를 먼저 제출
+        int submitted = IoUringEnter(ringFd_, pendingSubmit_, 0, 0);
+        if (submitted > 0) {
+            pendingSubmit_ -= std::min<unsigned>(pendingSubmit_, static_cast<unsigned>(submitted));
+        }
+        head = __atomic_load_n(sqHead_, __ATOMIC_ACQUIRE);
+        if (tail - head >= sqEntries_) {
+            std::cerr << "io_uring SQ full" << std::endl;
+            return nullptr;
+        }
+    }
+
+    unsigned index = tail & sqMask_;
+    io_uring_sqe* sqe = &sqes_[index];
+    memset(sqe, 0, sizeof(*sqe));
+    sqArray_[index] = index;
+    return sqe;
+}
+
+void IoUringBackend::CommitSqe() {
+    __atomic_store_n(sqTail_, *sqTail_ + 1, __ATOMIC_RELEASE);
+    ++pendingSubmit_;
+}
+
+void IoUringBackend::SetSqeFile(io_uring_sqe* sqe, const SocketContext& context) {
+    if (context.fileIndex >= 0) {
+        sqe->fd = context.fileIndex;
+        sqe->flags |= IOSQE_FIXED_FILE;
+    } else {
+        sqe->fd = context.socket;
+    }
+}
+
+void IoUringBackend::QueueRecv(SocketContext& context) {
+    std::lock_guard<std::mutex> lock(sqMutex_);
+    io_uring_sqe* sqe = AcquireSqe();
+    if (!sqe) {
+        context.failed = true;
+        return;
+    }
+
+    sqe->opcode = IORING_OP_RECV;
+    sqe->flags = IOSQE_BUFFER_SELECT;
+    SetSqeFile(sqe, context);
+    sqe->buf_group = RECV_BUFFER_GROUP;
+    sqe->ioprio = IORING_RECV_MULTISHOT;
+    sqe->user_data = reinterpret_cast<uint64_t>(context.recvRequest);
+    CommitSqe();
+}
+
+void IoUringBackend::QueueSend(SocketContext& context, Request* request) {
+    std::lock_guard<std::mutex> lock(sqMutex_);
+    io_uring_sqe* sqe = AcquireSqe();
+    if (!sqe) {
+        // 제출할 수 없으면 송신 실패로 완료 처리되도록 에러 CQE 대신 즉시 실패 기록
+        context.failed = true;
+        return;
+    }
+
+    OverlappedEx* overlapped = request->overlapped;
+    if (overlapped->SendBufferCount() == 1) {
+        sqe->opcode = IORING_OP_SEND;
+        sqe->addr = reinterpret_cast<uint64_t>(overlapped->SendBuffers()[0].buf + request->offset);
+        sqe->len = static_cast<uint32_t>(overlapped->SendLength() - request->offset);
+    } else {
+        // 여러 메시지를 모아 SENDMSG 한 번으로 전송 (부분 전송 시 남은 부분부터 다시 구성)
+        request->msg = {};
+        request->msg.msg_iov = request->iov;
+        request->msg.msg_iovlen = BuildSendIovec(overlapped, request->offset, request->iov);
+        sqe->opcode = IORING_OP_SENDMSG;
+        sqe->addr = reinterpret_cast<uint64_t>(&request->msg);
+        sqe->len = 1;
+    }
+    SetSqeFile(sqe, context);
+    sqe->msg_flags = MSG_NOSIGNAL;
+    sqe->user_data = reinterpret_cast<uint64_t>(request);
+    CommitSqe();
+}
+
+void IoUringBackend::QueueAccept(SocketContext& context) {
+    std::lock_guard<std::mutex> lock(sqMutex_);
+    io_uring_sqe* sqe = AcquireSqe();
+    if (!sqe) {
+        delete context.acceptRequest;
+        context.acceptRequest = nullptr;
+        context.acceptFailed = true;
+        return;
+    }
+
+    // SQE 하나로 연결이 들어올 때마다 CQE가 계속 올라옴 (커널 5.19 이상)
+    sqe->opcode = IORING_OP_ACCEPT;
+    SetSqeFile(sqe, context);
+    sqe->ioprio = IORING_ACCEPT_MULTISHOT;
+    sqe->accept_flags = SOCK_CLOEXEC;
+    sqe->user_data = reinterpret_cast<uint64_t>(context.acceptRequest);
+    CommitSqe();
+}
+
+void IoUringBackend::QueueCancel(Request* target) {
+    std::lock_guard<std::mutex> lock(sqMutex_);
+    io_uring_sqe* sqe = AcquireSqe();
+    if (!sqe) return;
+
+    sqe->opcode = IORING_OP_ASYNC_CANCEL;
+    sqe->fd = -1;
+    sqe->addr = reinterpret_cast<uint64_t>(target);
+    sqe->user_data = CANCEL_TAG;
+    CommitSqe();
+}
+
+void IoUringBackend::QueueNop() {
+    // sqMutex_ 보유 상태에서 호출
+    io_uring_sqe* sqe = AcquireSqe();
+    if (!sqe) return;
+
+    sqe->opcode = IORING_OP_NOP;
+    sqe->fd = -1;
+    sqe->user_data = WAKEUP_TAG;
+    CommitSqe();
+}
+
+void IoUringBackend::SubmitIfNotWorker() {
+    // 워커 스레드는 GetCompletions로 돌아갈 때 한 번에 제출
+    if (t_workerBackend != this) {
+        SubmitAndWait(0);
+    }
+}
+
+int IoUringBackend::SubmitAndWait(unsigned waitCount) {
+    unsigned toSubmit;
+    {
+        std::lock_guard<std::mutex> lock(sqMutex_);
+        toSubmit = pendingSubmit_;
+        pendingSubmit_ = 0;
+    }
+
+    if (toSubmit == 0 && waitCount == 0) return 0;
+
+    // 제출과 대기를 하나의 시스템콜로 처리
+    int result = IoUringEnter(ringFd_, toSubmit, waitCount, waitCount > 0 ? IORING_ENTER_GETEVENTS : 0);
+    unsigned submitted = (result > 0) ? static_cast<unsigned>(result) : 0;
+    if (submitted < toSubmit) {
+        std::lock_guard<std::mutex> lock(sqMutex_);
+        pendingSubmit_ += toSubmit - submitted;
+    }
+    return result;
+}
+
+bool IoUringBackend::ReapCqe(io_uring_cqe& cqe) {
+    std::lock_guard<std::mutex> lock(cqMutex_);
+    unsigned head = *cqHead_;
+    unsigned tail = __atomic_load_n(cqTail_, __ATOMIC_ACQUIRE);
+    if (head == tail) return false;
+
+    cqe = cqes_[head & cqMask_];
+    __atomic_store_n(cqHead_, head + 1, __ATOMIC_RELEASE);
+    return true;
+}
+
+void IoUringBackend::HandleCqe(const io_uring_cqe& cqe) {
+    if (cqe.user_data == WAKEUP_TAG || cqe.user_data == CANCEL_TAG) return;
+    if (cqe.user_data == PROVIDE_TAG) {
+        if (cqe.res < 0) {
+            std::cerr << "provide buffer failed: " << -cqe.res << std::endl;
+        }
+        return;
+    }
+
+    auto* request = reinterpret_cast<Request*>(cqe.user_data);
+    std::shared_ptr<SocketContext> context = request->context; // request 해제 후에도 유지
+
+    std::deque<IOCompletion> completed;
+    {
+        std::lock_guard<std::mutex> lock(context->lock);
+        if (request->kind == RequestKind::RECV) {
+            HandleRecvCqe(*context, request, cqe, completed);
+        } else if (request->kind == RequestKind::SEND) {
+            HandleSendCqe(*context, request, cqe.res, completed);
+        } else {
+            HandleAcceptCqe(*context, request, cqe, completed);
+        }
+    }
+
+    PushCompletions(completed);
+    RearmStarved();
+}
+
+void IoUringBackend::HandleRecvCqe(SocketContext& context, Request* request, const io_uring_cqe& cqe,
+                                   std::deque<IOCompletion>& completed) {
+    bool more = (cqe.flags & IORING_CQE_F_MORE) != 0;
+
+    if (cqe.flags & IORING_CQE_F_BUFFER) {
+        uint16_t bufferId = static_cast<uint16_t>(cqe.flags >> IORING_CQE_BUFFER_SHIFT);
+        if (cqe.res > 0 && !context.closed) {
+            context.backlog.push_back({ bufferId, static_cast<uint32_t>(cqe.res), 0 });
+        } else {
+            ReturnRecvBuffer(bufferId);
+        }
+    }
+
+    if (!context.closed) {
+        if (cqe.res == 0) {
+            context.eof = true;
+        } else if (cqe.res == -ENOBUFS) {
+            // 공유 버퍼가 고갈됨 - 버퍼가 반환되면 다시 건다
+            context.starved = true;
+            std::lock_guard<std::mutex> lock(starvedMutex_);
+            starved_.push_back(context.weak_from_this());
+        } else if (cqe.res < 0 && cqe.res != -ECANCELED) {
+            std::cerr << "recv failed: " << -cqe.res << " (소켓: " << context.socket << ")" << std::endl;
+            context.failed = true;
+        }
+    }
+
+    if (!more) {
+        // multishot 종료 (EOF, 에러, 취소, 버퍼 고갈)
+        if (context.recvRequest == request) context.recvRequest = nullptr;
+        context.cancelRequested = false;
+        delete request;
+    }
+
+    if (context.closed) return;
+
+    // 세션이 처리하지 못한 버퍼가 너무 많으면 multishot을 멈춰 공유 풀을 보호
+    if (more && context.backlog.size() >= MAX_RECV_BACKLOG && !context.cancelRequested) {
+        QueueCancel(context.recvRequest);
+        context.cancelRequested = true;
+    }
+
+    DeliverRecv(context, completed);
+    MaybeArmRecv(context);
+}
+
+void IoUringBackend::HandleSendCqe(SocketContext& context, Request* request, int result,
+                                   std::deque<IOCompletion>& completed) {
+    OverlappedEx* overlapped = request->overlapped;
+
+    if (context.closed) {
+        // 세션이 이미 정리됨 - 결과와 무관하게 버퍼만 해제
+        context.sendRequest = nullptr;
+        IoContextPool::Release(overlapped);
+        delete request;
+        return;
+    }
+
+    if (result < 0) {
+        std::cerr << "send failed: " << -result << " (소켓: " << context.socket << ")" << std::endl;
+        completed.push_back({ false, 0, context.session, overlapped });
+        for (auto* pending : context.pendingSends) {
+            completed.push_back({ false, 0, context.session, pending });
+        }
+        context.pendingSends.clear();
+
+        context.sendRequest = nullptr;
+        delete request;
+        return;
+    }
+
+    request->offset += static_cast<size_t>(result);
+    size_t totalLength = overlapped->SendLength();
+    if (request->offset < totalLength) {
+        // 부분 전송 - 나머지를 같은 요청으로 다시 제출
+        QueueSend(context, request);
+        return;
+    }
+
+    completed.push_back({ true, static_cast<DWORD>(totalLength), context.session, overlapped });
+    context.sendRequest = nullptr;
+    delete request;
+
+    StartNextSend(context);
+}
+
+void IoUringBackend::HandleAcceptCqe(SocketContext& context, Request* request, const io_uring_cqe& cqe,
+                                     std::deque<IOCompletion>& completed) {
+    bool more = (cqe.flags & IORING_CQE_F_MORE) != 0;
+
+    if (cqe.res >= 0) {
+        if (context.closed) {
+            closesocket(cqe.res); // 리슨 소켓이 이미 해제됨 (취소 경합)
+        } else {
+            context.acceptBacklog.push_back(cqe.res);
+        }
+    } else if (cqe.res != -ECANCELED && !context.closed) {
+        std::cerr << "accept failed: " << -cqe.res << " (리슨 소켓: " << context.socket << ")" << std::endl;
+        context.acceptFailed = true;
+    }
+
+    if (!more) {
+        // multishot 종료 (에러, 취소)
+        if (context.acceptRequest == request) context.acceptRequest = nullptr;
+        context.acceptCancelRequested = false;
+        delete request;
+    }
+
+    if (context.closed) return;
+
+    // 전달하지 못한 소켓이 너무 많으면 multishot을 멈추고 커널 listen 큐에 남겨둠
+    if (more && context.acceptBacklog.size() >= MAX_ACCEPT_BACKLOG && !context.acceptCancelRequested) {
+        QueueCancel(context.acceptRequest);
+        context.acceptCancelRequested = true;
+    }
+
+    DeliverAccepts(context, completed);
+    MaybeArmAccept(context);
+}
+
+char* IoUringBackend::RecvBufferAddress(uint16_t bufferId) const {
+    return recvBuffers_ + static_cast<size_t>(bufferId) * RECV_BUFFER_SIZE;
+}
+
+void IoUringBackend::ReturnRecvBuffer(uint16_t bufferId) {
+    // 반납도 SQE로 - 다른 요청과 함께 다음 io_uring_enter에서 일괄 제출됨
+    std::lock_guard<std::mutex> lock(sqMutex_);
+    io_uring_sqe* sqe = AcquireSqe();
+    if (!sqe) return;
+
+    sqe->opcode = IORING_OP_PROVIDE_BUFFERS;
+    sqe->fd = 1;
+    sqe->addr = reinterpret_cast<uint64_t>(RecvBufferAddress(bufferId));
+    sqe->len = RECV_BUFFER_SIZE;
+    sqe->off = bufferId;
+    sqe->buf_group = RECV_BUFFER_GROUP;
+    sqe->user_data = PROVIDE_TAG;
+    CommitSqe();
+
+    recvBuffersReturned_ = true;
+}
+
+void IoUringBackend::RearmStarved() {
+    // 버퍼가 반환된 경우에만 고갈됐던 소켓의 recv를 다시 건다
+    if (!recvBuffersReturned_.exchange(false)) return;
+
+    std::vector<std::weak_ptr<SocketContext>> starved;
+    {
+        std::lock_guard<std::mutex> lock(starvedMutex_);
+        if (starved_.empty()) return;
+        starved.swap(starved_);
+    }
+
+    for (auto& weak : starved) {
+        if (auto context = weak.lock()) {
+            std::lock_guard<std::mutex> lock(context->lock);
+            context->starved = false;
+            MaybeArmRecv(*context);
+        }
+    }
+}
+
+int IoUringBackend::AcquireFileSlot(SOCKET socket) {
+    int slot;
+    {
+        std::lock_guard<std::mutex> lock(fileSlotMutex_);
+        if (freeFileSlots_.empty()) return -1;
+
+        slot = freeFileSlots_.back();
+        freeFileSlots_.pop_back();
+    }
+
+    io_uring_files_update update = {};
+    update.offset = static_cast<uint32_t>(slot);
+    update.fds = reinterpret_cast<uint64_t>(&socket);
+    if (IoUringRegister(ringFd_, IORING_REGISTER_FILES_UPDATE, &update, 1) < 1) {
+        ReleaseFileSlot(slot);
+        return -1;
+    }
+    return slot;
+}
+
+void IoUringBackend::ReleaseFileSlot(int slot) {
+    if (slot < 0) return;
+
+    std::lock_guard<std::mutex> lock(fileSlotMutex_);
+    freeFileSlots_.push_back(slot);
+}
+
+void IoUringBackend::PushCompletions(std::deque<IOCompletion>& completed) {
+    if (completed.empty()) return;
+
+    std::lock_guard<std::mutex> lock(completionMutex_);
+    for (auto& completion : completed) {
+        completions_.push_back(completion);
+    }
+}
+
+int IoUringBackend::PopCompletions(IOCompletion* completions, int maxCount) {
+    std::lock_guard<std::mutex> lock(completionMutex_);
+
+    int count = 0;
+    while (count < maxCount && !completions_.empty()) {
+        completions[count++] = completions_.front();
+        completions_.pop_front();
+    }
+    return count;
+}
+
+bool IoUringBackend::GetCompletions(IOCompletion* completions, int maxCount, int& count, bool wait) {
+    t_workerBackend = this;
+    maxCount = std::min<int>(std::max<int>(maxCount, 1), MAX_COMPLETION_BATCH);
+    count = 0;
+
+    while (true) {
+        if (shuttingDown_) {
+            // 다른 워커도 깨어나도록 NOP을 하나 남기고 종료
+            {
+                std::lock_guard<std::mutex> lock(sqMutex_);
+                QueueNop();
+            }
+            SubmitAndWait(0);
+            return false;
+        }
+
+        // 도착한 CQE를 한꺼번에 완료 큐로 옮긴 뒤 최대 maxCount개를 가져감
+        io_uring_cqe cqe;
+        int reaped = 0;
+        while (reaped < maxCount && ReapCqe(cqe)) {
+            HandleCqe(cqe);
+            ++reaped;
+        }
+
+        bool notified = notified_.exchange(false);
+        count = PopCompletions(completions, maxCount);
+        if (count > 0 || notified) {
+            // 직전 배치의 핸들러가 만든 SQE(송신, recv 재무장 등)를 한 번에 제출하고 반환
+            SubmitAndWait(0);
+            return true;
+        }
+        if (reaped > 0) continue;
+
+        ArmDeferredAccepts();
+
+        // 바쁜 대기: CQ 링은 사용자 공간에서 바로 보이므로 제출만 하고 반환 (시스템콜 없이 다시 확인)
+        if (!wait) {
+            SubmitAndWait(0);
+            return true;
+        }
+
+        // 처리할 것이 없으면 제출 + 완료 대기를 한 번에
+        if (SubmitAndWait(1) < 0 && errno != EINTR && errno != EAGAIN && errno != EBUSY) {
+            std::cerr << "io_uring_enter failed: " << errno << std::endl;
+            return false;
+        }
+    }
+}
+
+void IoUringBackend::PostShutdown(int workerCount) {
+    shuttingDown_ = true;
+
+    {
+        std::lock_guard<std::mutex> lock(sqMutex_);
+        for (int i = 0; i < workerCount; ++i) {
+            QueueNop();
+        }
+    }
+    SubmitAndWait(0);
+}
+
+void IoUringBackend::Wakeup() {
+    // 플래그를 먼저 세우고 NOP으로 깨움 (대기 직전에 플래그를 놓쳐도 NOP 완료로 다시 확인)
+    notified_ = true;
+    {
+        std::lock_guard<std::mutex> lock(sqMutex_);
+        QueueNop();
+    }
+    SubmitIfNotWorker();
+}
+
+#endif // __linux__
@@ -0,0 +1,245 @@
+#include "ListenerHandoff.h"
+#include <iostream>
+#include <cstring>
+#ifndef _WIN32
+#include <sys/un.h>
+#include <sys/time.h>
+#endif
+
+ListenerHandoff::ListenerHandoff(const std::string& path)
+    : path_(path), peer_(INVALID_SOCKET), listener_(INVALID_SOCKET), serving_(false) {
+}
+
+ListenerHandoff::~ListenerHandoff() {
+    Stop();
+    if (peer_ != INVALID_SOCKET) {
+        closesocket(peer_);
+        peer_ = INVALID_SOCKET;
+    }
+}
+
+#ifdef _WIN32
+
+bool ListenerHandoff::Receive(std::vector<SOCKET>& sockets) {
+    sockets.clear();
+    std::cerr << "리슨 소켓 인계는 Windows에서 지원하지 않습니다" << std::endl;
+    return false;
+}
+
+void ListenerHandoff::Confirm() {
+}
+
+bool ListenerHandoff::Serve(SocketProvider, HandedOffHandler) {
+    std::cerr << "리슨 소켓 인계는 Windows에서 지원하지 않습니다" << std::endl;
+    return false;
+}
+
+void ListenerHandoff::Stop() {
+}
+
+void ListenerHandoff::ServeLoop(SocketProvider, HandedOffHandler) {
+}
+
+bool ListenerHandoff::SendSockets(SOCKET, const std::vector<SOCKET>&) {
+    return false;
+}
+
+#else
+
+namespace {
+    bool MakeAddress(const std::string& path, sockaddr_un& addr) {
+        if (path.empty() || path.size() >= sizeof(addr.sun_path)) {
+            std::cerr << "Invalid handoff socket path: " << path << std::endl;
+            return false;
+        }
+        memset(&addr, 0, sizeof(addr));
+        addr.sun_family = AF_UNIX;
+        memcpy(addr.sun_path, path.c_str(), path.size());
+        return true;
+    }
+
+    bool IsListeningTcpSocket(SOCKET socket) {
+        int value = 0;
+        socklen_t length = sizeof(value);
+        if (getsockopt(socket, SOL_SOCKET, SO_ACCEPTCONN, &value, &length) != 0 || !value) return false;
+        length = sizeof(value);
+        return getsockopt(socket, SOL_SOCKET, SO_TYPE, &value, &length) == 0 && value == SOCK_STREAM;
+    }
+}
+
+bool ListenerHandoff::Receive(std::vector<SOCKET>& sockets) {
+    sockets.clear();
+
+    sockaddr_un addr;
+    if (!MakeAddress(path_, addr)) return false;
+
+    SOCKET peer = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+    if (peer == INVALID_SOCKET) return false;
+
+    // 기존 프로세스가 없으면 (파일 없음 / 남은 파일뿐) 조용히 새로 시작
+    if (connect(peer, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) != 0) {
+        closesocket(peer);
+        return false;
+    }
+
+    // 소켓 수 1바이트 + SCM_RIGHTS
+    unsigned char count = 0;
+    iovec iov = { &count, sizeof(count) };
+    alignas(cmsghdr) char control[CMSG_SPACE(sizeof(int) * MAX_SOCKETS)];
+    msghdr msg = {};
+    msg.msg_iov = &iov;
+    msg.msg_iovlen = 1;
+    msg.msg_control = control;
+    msg.msg_controllen = sizeof(control);
+
+    ssize_t received = recvmsg(peer, &msg, MSG_CMSG_CLOEXEC);
+    if (received != static_cast<ssize_t>(sizeof(count))) {
+        std::cerr << "리슨 소켓 인계 수신 실패: " << (received < 0 ? errno : 0) << std::endl;
+        closesocket(peer);
+        return false;
+    }
+
+    for (cmsghdr* cmsg = CMSG_FIRSTHDR(&msg); cmsg; cmsg = CMSG_NXTHDR(&msg, cmsg)) {
+        if (cmsg->cmsg_level != SOL_SOCKET || cmsg->cmsg_type != SCM_RIGHTS) continue;
+
+        size_t fdCount = (cmsg->cmsg_len - CMSG_LEN(0)) / sizeof(int);
+        const unsigned char* data = CMSG_DATA(cmsg);
+        for (size_t i = 0; i < fdCount; ++i) {
+            int fd;
+            memcpy(&fd, data + i * sizeof(int), sizeof(int));
+            sockets.push_back(fd);
+        }
+    }
+
+    // 잘린 메시지나 리슨 소켓이 아닌 것이 섞여 있으면 받은 것을 모두 버림
+    bool valid = !sockets.empty() && sockets.size() == count && !(msg.msg_flags & MSG_CTRUNC);
+    for (SOCKET socket : sockets) {
+        valid = valid && IsListeningTcpSocket(socket);
+    }
+    if (!valid) {
+        std::cerr << "인계받은 리슨 소켓이 올바르지 않습니다 (" << sockets.size() << "/" << int(count) << ")" << std::endl;
+        for (SOCKET socket : sockets) closesocket(socket);
+        sockets.clear();
+        closesocket(peer);
+        return false;
+    }
+
+    peer_ = peer;
+    std::cout << "리슨 소켓 " << sockets.size() << "개 인계받음 (" << path_ << ")" << std::endl;
+    return true;
+}
+
+void ListenerHandoff::Confirm() {
+    if (peer_ == INVALID_SOCKET) return;
+
+    char ack = 1;
+    if (send(peer_, &ack, sizeof(ack), MSG_NOSIGNAL) != sizeof(ack)) {
+        std::cerr << "리슨 소켓 인계 확인 전송 실패: " << errno << std::endl;
+    }
+    closesocket(peer_);
+    peer_ = INVALID_SOCKET;
+}
+
+bool ListenerHandoff::Serve(SocketProvider provider, HandedOffHandler onHandedOff) {
+    if (serving_) return true;
+
+    sockaddr_un addr;
+    if (!MakeAddress(path_, addr)) return false;
+
+    listener_ = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+    if (listener_ == INVALID_SOCKET) {
+        std::cerr << "handoff socket() failed: " << errno << std::endl;
+        return false;
+    }
+
+    // 이전 프로세스가 남긴 경로는 지우고 이 프로세스가 이어받음
+    // (이전 프로세스는 이미 인계를 마쳤으므로 자기 경로를 지우지 않음)
+    unlink(path_.c_str());
+    if (bind(listener_, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) != 0 || listen(listener_, 1) != 0) {
+        std::cerr << "handoff bind/listen failed on " << path_ << ": " << errno << std::endl;
+        closesocket(listener_);
+        listener_ = INVALID_SOCKET;
+        return false;
+    }
+
+    serving_ = true;
+    serveThread_ = std::thread(&ListenerHandoff::ServeLoop, this, std::move(provider), std::move(onHandedOff));
+    std::cout << "Listener handoff ready on " << path_ << std::endl;
+    return true;
+}
+
+void ListenerHandoff::Stop() {
+    if (serving_.exchange(false) && listener_ != INVALID_SOCKET) {
+        shutdown(listener_, SHUT_RDWR); // 블로킹된 accept를 깨움
+    }
+    if (serveThread_.joinable()) {
+        serveThread_.join();
+    }
+    if (listener_ != INVALID_SOCKET) {
+        closesocket(listener_);
+        listener_ = INVALID_SOCKET;
+    }
+}
+
+void ListenerHandoff::ServeLoop(SocketProvider provider, HandedOffHandler onHandedOff) {
+    while (serving_) {
+        SOCKET peer = accept4(listener_, nullptr, nullptr, SOCK_CLOEXEC);
+        if (peer == INVALID_SOCKET) {
+            if (errno == EINTR || errno == ECONNABORTED) continue;
+            break; // Stop()
+        }
+
+        std::vector<SOCKET> sockets = provider ? provider() : std::vector<SOCKET>();
+        if (!SendSockets(peer, sockets)) {
+            closesocket(peer);
+            continue;
+        }
+
+        // 새 프로세스가 수락을 시작했다고 알려줄 때까지 대기 - 그 전에는 계속 수락
+        timeval timeout = { CONFIRM_TIMEOUT_SEC, 0 };
+        setsockopt(peer, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+        char ack = 0;
+        ssize_t received = recv(peer, &ack, sizeof(ack), 0);
+        closesocket(peer);
+
+        if (received != sizeof(ack)) {
+            std::cerr << "새 프로세스가 수락 시작을 확인하지 않아 계속 수락합니다" << std::endl;
+            continue;
+        }
+
+        std::cout << "리슨 소켓 인계 완료 - 새 연결은 새 프로세스가 받습니다" << std::endl;
+        serving_ = false;
+        if (onHandedOff) onHandedOff();
+        break;
+    }
+}
+
+bool ListenerHandoff::SendSockets(SOCKET peer, const std::vector<SOCKET>& sockets) {
+    if (sockets.empty() || sockets.size() > MAX_SOCKETS) {
+        std::cerr << "인계할 리슨 소켓 수가 올바르지 않습니다: " << sockets.size() << std::endl;
+        return false;
+    }
+
+    unsigned char count = static_cast<unsigned char>(sockets.size());
+    iovec iov = { &count, sizeof(count) };
+    alignas(cmsghdr) char control[CMSG_SPACE(sizeof(int) * MAX_SOCKETS)] = {};
+    msghdr msg = {};
+    msg.msg_iov = &iov;
+    msg.msg_iovlen = 1;
+    msg.msg_control = control;
+    msg.msg_controllen = CMSG_SPACE(sizeof(int) * sockets.size());
+
+    cmsghdr* cmsg = CMSG_FIRSTHDR(&msg);
+    cmsg->cmsg_level = SOL_SOCKET;
+    cmsg->cmsg_type = SCM_RIGHTS;
+    cmsg->cmsg_len = CMSG_LEN(sizeof(int) * sockets.size());
+    memcpy(CMSG_DATA(cmsg), sockets.data(), sizeof(int) * sockets.size());
+
+    if (sendmsg(peer, &msg, MSG_NOSIGNAL) != static_cast<ssize_t>(sizeof(count))) {
+        std::cerr << "리슨 소켓 인계 전송 실패: " << errno << std::endl;
+        return false;
+    }
+    return true;
+}
+
+#endif
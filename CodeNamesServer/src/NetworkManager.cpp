@@ -2,83 +2,146 @@
 #include "NetworkManager.h"
 #include "SessionManager.h"
 #include "Session.h"
-#include <winsock2.h>
-#include <mswsock.h>
+#include "IoContextPool.h"
+#include "SessionSlotMap.h"
+#include "PacketProtocol.h"
 #include <iostream>
 #include <thread>
+#include <chrono>
 #include <stdexcept>
+#include <algorithm>
+#include <cstring>
+#ifndef _WIN32
+#include <pthread.h>
+#include <sched.h>
+#include <sys/un.h>
+#include <sys/stat.h>
+#endif
+
+namespace {
+    // 완료 배치를 처리 중인 워커의 송신 대기 세션 목록 (배치 밖이면 nullptr)
+    // 참조 카운트 없이 핸들만 모아두고 배치 끝에서 다시 조회 (그 사이 제거/재사용된 세션은 조회 실패로 건너뜀)
+    thread_local std::vector<SessionHandle>* t_sendBatch = nullptr;
+
+    // 바쁜 대기 루프에서 같은 코어의 다른 하이퍼스레드에 실행 자원을 양보
+    inline void CpuRelax() {
+#if defined(_WIN32)
+        YieldProcessor();
+#elif defined(__x86_64__) || defined(__i386__)
+        __builtin_ia32_pause();
+#elif defined(__aarch64__)
+        asm volatile("yield");
+#endif
+    }
+}
 
-NetworkManager::NetworkManager(int port, IMediator* server)
-    : iocpHandle_(nullptr), listenSocket_(INVALID_SOCKET),
-        isRunning_(false), workerThreadCount_(4),
-        server_(server) {
+NetworkManager::NetworkManager(int port, IMediator* server, IOBackendType backendType, int shardCount,
+                               int completionBatch, std::vector<SOCKET> inheritedListenSockets)
+    : server_(server), sessions_(nullptr), sessionPoolSize_(IOCPServer::SESSION_POOL_SIZE), sessionPool_(this),
+        backendType_(backendType), shardCount_(shardCount), nextShard_(0), acceptHandoff_(false), accepting_(false), unixListenSocket_(INVALID_SOCKET), unixSocketInode_(0),
+        isRunning_(false), workerThreadCount_(shardCount > 0 ? shardCount : 4),
+        completionBatch_(std::min<int>(std::max<int>(completionBatch, 1), IOBackend::MAX_COMPLETION_BATCH)), busyPollUs_(0),
+        acceptedCount_(0), recvCount_(0), sendCount_(0),
+        busyCount_(0), rejectedCount_(0), maxConnections_(IOCPServer::MAX_CLIENTS),
+        softConnections_(IOCPServer::MAX_CLIENTS), overloaded_(false) {
     
+#ifdef _WIN32
     // WSAStartup 호출
     WSADATA wsaData;
     if (WSAStartup(MAKEWORD(2, 2), &wsaData) != 0)
     {
         throw std::runtime_error("WSAStartup failed");
     }
+#endif
+
+    // 인계받은 리슨 소켓은 이전 프로세스의 대기열을 그대로 이어받으므로 재시작 중 연결을 잃지 않음
+    listenSockets_ = std::move(inheritedListenSockets);
+    bool inherited = !listenSockets_.empty();
+
+#ifdef _WIN32
+    int listenCount = 1; // AcceptEx를 여러 개 걸어 하나의 리슨 소켓에서 병렬로 수락
+#else
+    int listenCount = workerThreadCount_; // 워커(샤드) 수만큼 리슨 소켓을 두고 커널이 연결을 분산 (SO_REUSEPORT)
+#endif
+    for (int i = 0; !inherited && i < listenCount; ++i) {
+        SOCKET listenSocket = CreateListenSocket(port, listenCount > 1);
+        if (listenSocket == INVALID_SOCKET) break; // SO_REUSEPORT 미지원 시 만들어진 것까지만 사용
+        listenSockets_.push_back(listenSocket);
+    }
 
-    listenSocket_ = CreateListenSocket(port);
-    if (listenSocket_ == INVALID_SOCKET) {
+    if (listenSockets_.empty()) {
+#ifdef _WIN32
         WSACleanup(); // Startup 이후 실패 시 Cleanup
+#endif
         throw std::runtime_error("Failed to create listen socket");
     }   
 }
 
 NetworkManager::~NetworkManager() {
     // 서버 종료 Flag
-    isRunning_ = false;
-
-    // Accept 스레드 종료 대기
-    if (acceptThread_.joinable()) {
-        acceptThread_.join();
+    {
+        std::lock_guard<std::mutex> lock(statsMutex_);
+        isRunning_ = false;
     }
+    statsCv_.notify_all();
 
-    // 스레드 종료 신호 보내기
-    if (iocpHandle_) {
-        for (size_t i = 0; i < workerThreads_.size(); ++i) {
-            PostQueuedCompletionStatus(iocpHandle_, 0, 0, nullptr);
-        }
+    if (statsThread_.joinable()) {
+        statsThread_.join();
     }
 
-    // 스레드 종료 로그 추가
-    std::cout << "Waiting for worker threads to terminate..." << std::endl;
-    for (auto& thread : workerThreads_) {
-        if (thread.joinable()) {
-            thread.join(); // 정상적으로 종료되길 기대
-        }
-    }
-    std::cout << "All worker threads terminated" << std::endl;
+    StopWorkerThreads();
 
     // 리소스 정리
-    if (listenSocket_ != INVALID_SOCKET) {
-        closesocket(listenSocket_);
-    }   
-
-    if (iocpHandle_) {
-        CloseHandle(iocpHandle_);
+    for (SOCKET listenSocket : listenSockets_) {
+        closesocket(listenSocket);
     }
+    listenSockets_.clear();
+    CloseUnixListenSocket();
+
+    shards_.clear();
 
+#ifdef _WIN32
     WSACleanup();
+#endif
 }
 
-void NetworkManager::RemoveSession(SOCKET socket) {
+void NetworkManager::RemoveSession(SessionHandle handle) {
     if (server_) {
-        server_->RemoveSession(socket);
+        server_->RemoveSession(handle);
     }
 }
 
 bool NetworkManager::Initialize() {
-    // IOCP 생성
-    if (!CreateIOCP()) {
-        std::cerr << "Failed to create IOCP" << std::endl;
+    // 완료의 세션 핸들을 풀어줄 슬롯 맵 (SessionManager가 먼저 생성되어 있어야 함)
+    sessions_ = server_ ? server_->GetSessionSlots() : nullptr;
+    if (!sessions_) {
+        std::cerr << "Session slot map is not available" << std::endl;
         return false;
     }
 
-    // Worker Thread 생성
-    CreateWorkerThreads(workerThreadCount_);
+    if (!sessionPool_.Initialize(sessionPoolSize_)) {
+        std::cerr << "Failed to create session pool" << std::endl;
+        return false;
+    }
+
+    // 샤드별 I/O 백엔드 생성 (Windows: IOCP, Linux: epoll) - 공유 워커 모드는 1개
+    int shardCount = shardCount_ > 0 ? shardCount_ : 1;
+    for (int i = 0; i < shardCount; ++i) {
+        auto backend = CreateBackend();
+        if (!backend) {
+            std::cerr << "Failed to create I/O backend" << std::endl;
+            shards_.clear();
+            return false;
+        }
+        shards_.push_back(std::make_unique<Shard>(i, std::move(backend)));
+    }
+
+    // 워커가 루프 조건을 보기 전에 가동 상태로 변경
+    isRunning_ = true;
+
+    // Worker Thread 생성 (샤드 모드: 샤드당 1개)
+    CreateWorkerThreads(shardCount_ > 0 ? 1 : workerThreadCount_);
+    statsThread_ = std::thread(&NetworkManager::StatsThread, this);
 
     // Accept 시작
     // if (!StartAccept()) {
@@ -86,56 +149,114 @@ bool NetworkManager::Initialize() {
     //     return false;
     // }
 
-    // 서버 가동상태 변경
-    isRunning_ = true;
-    
-    std::cout << "NetworkManager initialized successfully" << std::endl;
+    std::cout << "NetworkManager initialized successfully (backend: " << GetBackendName()
+              << ", shards: " << shards_.size();
+    if (busyPollUs_ > 0) std::cout << ", busy poll: " << busyPollUs_ << "us";
+    std::cout << ")" << std::endl;
     return true;
 }
 
 void NetworkManager::Shutdown() {
-    isRunning_ = false;
+    {
+        std::lock_guard<std::mutex> lock(statsMutex_);
+        isRunning_ = false;
+    }
+    statsCv_.notify_all();
+    accepting_ = false;
     
-    if (listenSocket_ != INVALID_SOCKET) {
-        closesocket(listenSocket_);
-        listenSocket_ = INVALID_SOCKET;
+    // 걸어둔 accept를 정리한 뒤 리슨 소켓 닫기 (IOCP는 close 시 실패 완료로 돌아옴)
+    for (size_t i = 0; i < listenSockets_.size(); ++i) {
+        if (!shards_.empty()) {
+            DissociateSocket(listenSockets_[i], static_cast<int>(i % shards_.size()));
+        }
+        closesocket(listenSockets_[i]);
     }
+    listenSockets_.clear();
+    if (unixListenSocket_ != INVALID_SOCKET && !shards_.empty()) {
+        DissociateSocket(unixListenSocket_, 0);
+    }
+    CloseUnixListenSocket();
+
+    // 워커를 여기서 멈춰야 이후 게임방/세션 정리가 워커와 겹치지 않음 (핸들 조회도 안전)
+    StopWorkerThreads();
     
     std::cout << "NetworkManager shutdown complete" << std::endl;
 }
 
-bool NetworkManager::CreateIOCP()
+std::unique_ptr<IOBackend> NetworkManager::CreateBackend()
 {
-    iocpHandle_ = CreateIoCompletionPort(
-        INVALID_HANDLE_VALUE, // 기존 파일 핸들 (소켓 연결용이 아닌 새로 생성)
-        NULL,                 // 기존 IOCP 핸들 (새로 생성하므로 NULL)
-        0,                    // CompletionKey (새로 생성하므로 0)
-        0                     // 동시 실행 스레드 수 (0 = 시스템이 결정)
-    );
-
-    if (iocpHandle_ == NULL) 
-    {
-        std::cerr << "CreateIoCompletionPort failed: " << GetLastError() << std::endl;
-        return false;
+    auto backend = IOBackend::CreateBackend(backendType_);
+    if (backend && backend->Create()) {
+        return backend;
     }
 
-    std::cout << "IOCP created successfully" << std::endl;
-    return true;
+    // 요청한 백엔드를 쓸 수 없으면 (예: io_uring 미지원 커널) 플랫폼 기본값으로 대체
+    // (이후 샤드도 대체된 백엔드를 사용)
+    if (backendType_ == IOBackend::DefaultType()) {
+        return nullptr;
+    }
+    std::cerr << "요청한 I/O 백엔드 생성 실패, 기본 백엔드로 대체합니다" << std::endl;
+
+    backendType_ = IOBackend::DefaultType();
+    backend = IOBackend::CreateBackend(backendType_);
+    if (!backend || !backend->Create()) {
+        return nullptr;
+    }
+    return backend;
 }
 
-void NetworkManager::CreateWorkerThreads(int count) {
+void NetworkManager::CreateWorkerThreads(int countPerShard) {
     // 벡터 크기 미리 할당 (성능 최적화)
-    workerThreads_.reserve(count);
+    workerThreads_.reserve(shards_.size() * countPerShard);
+
+    // 샤드 모드에서는 샤드 i의 워커를 CPU i에 고정 (CPU보다 샤드가 많으면 나머지로 순환)
+    unsigned coreCount = std::max<unsigned>(1, std::thread::hardware_concurrency());
+    for (auto& shard : shards_) {
+        int pinnedCore = shardCount_ > 0 ? static_cast<int>(shard->GetIndex() % coreCount) : -1;
+        for (int i = 0; i < countPerShard; ++i) {
+            workerThreads_.emplace_back(&NetworkManager::WorkerThreads, this, shard.get(), pinnedCore);
+        }
+    }
+
+    std::cout << "Created " << workerThreads_.size() << " worker threads" << std::endl;
+}
+
+void NetworkManager::StopWorkerThreads() {
+    if (workerThreads_.empty()) return;
 
-    for (int i = 0; i < count; ++i) {
-        workerThreads_.emplace_back(&NetworkManager::WorkerThreads, this);
+    // 스레드 종료 신호 보내기 (샤드마다 그 샤드의 워커 수만큼)
+    for (auto& shard : shards_) {
+        shard->GetBackend()->PostShutdown(static_cast<int>(workerThreads_.size() / shards_.size()));
     }
-    
 
-    std::cout << "Created " << count << " worker threads" << std::endl;
+    // 스레드 종료 로그 추가
+    std::cout << "Waiting for worker threads to terminate..." << std::endl;
+    for (auto& thread : workerThreads_) {
+        if (thread.joinable()) {
+            thread.join(); // 정상적으로 종료되길 기대
+        }
+    }
+    workerThreads_.clear();
+    std::cout << "All worker threads terminated" << std::endl;
 }
 
-SOCKET NetworkManager::CreateListenSocket(int port) {
+void NetworkManager::PinCurrentThread(int core) {
+#ifdef _WIN32
+    if (SetThreadAffinityMask(GetCurrentThread(), static_cast<DWORD_PTR>(1) << core) == 0) {
+        std::cerr << "SetThreadAffinityMask failed: " << GetLastError() << std::endl;
+    }
+#else
+    cpu_set_t cpuSet;
+    CPU_ZERO(&cpuSet);
+    CPU_SET(core, &cpuSet);
+    int result = pthread_setaffinity_np(pthread_self(), sizeof(cpuSet), &cpuSet);
+    if (result != 0) {
+        std::cerr << "pthread_setaffinity_np failed: " << result << std::endl;
+    }
+#endif
+}
+
+SOCKET NetworkManager::CreateListenSocket(int port, bool reusePort) {
     // TCP 소켓 생성
     SOCKET listenSocket = socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
     if (listenSocket == INVALID_SOCKET) {
@@ -147,8 +268,20 @@ SOCKET NetworkManager::CreateListenSocket(int port) {
     int optval = 1;
     if (setsockopt(listenSocket, SOL_SOCKET, SO_REUSEADDR,
                    reinterpret_cast<const char*>(&optval), sizeof(optval)) == SOCKET_ERROR) {
+        std::cerr << "setsockopt(SO_REUSEADDR) failed: " << WSAGetLastError() << std::endl;
+    }
 
+#ifdef SO_REUSEPORT
+    // 같은 포트에 리슨 소켓을 여러 개 열고 커널이 새 연결을 나눠 담도록 함
+    if (reusePort && setsockopt(listenSocket, SOL_SOCKET, SO_REUSEPORT,
+                                reinterpret_cast<const char*>(&optval), sizeof(optval)) == SOCKET_ERROR) {
+        std::cerr << "setsockopt(SO_REUSEPORT) failed: " << WSAGetLastError() << std::endl;
+        closesocket(listenSocket);
+        return INVALID_SOCKET;
     }
+#else
+    (void)reusePort;
+#endif
 
     // 주소 구조체 설정
     sockaddr_in serverAddr = {};
@@ -176,24 +309,46 @@ SOCKET NetworkManager::CreateListenSocket(int port) {
     return listenSocket;
 }
 
-void NetworkManager::HandleNewClient(SOCKET clientSocket, const sockaddr_in& clientAddr) {
-    // Session 생성
-    auto session = std::make_shared<Session>(clientSocket, this);
-
-    // IOCP에 소켓 연결
-    if (!AssociateSocketWithIOCP(clientSocket, session.get())) {
-        std::cerr << "Failed to associate client socket with IOCP" << std::endl;
-        closesocket(clientSocket);
-        return;
+void NetworkManager::HandleNewClient(SOCKET clientSocket, const sockaddr_in& clientAddr, int shardIndex) {
+    // Session 생성 (이후 이 세션의 I/O는 shardIndex 샤드의 워커가 처리)
+    auto session = sessionPool_.Acquire(clientSocket);
+    session->SetShardIndex(shardIndex);
+
+    // 저지연 모드: Nagle을 끄고 (작은 응답이 상대의 지연 ACK를 기다리지 않게)
+    // Linux는 이 소켓의 수신에서 커널도 인터럽트를 기다리지 않고 NIC 큐를 직접 확인 (SO_BUSY_POLL)
+    // 유닉스 도메인 소켓 연결은 둘 다 해당 없음 (TCP도 NIC도 아님)
+    if (busyPollUs_ > 0 && clientAddr.sin_family == AF_INET) {
+        int noDelay = 1;
+        setsockopt(clientSocket, IPPROTO_TCP, TCP_NODELAY, reinterpret_cast<const char*>(&noDelay), sizeof(noDelay));
+#ifdef SO_BUSY_POLL
+        if (setsockopt(clientSocket, SOL_SOCKET, SO_BUSY_POLL, &busyPollUs_, sizeof(busyPollUs_)) != 0) {
+            static std::atomic<bool> warned(false);
+            if (!warned.exchange(true)) {
+                std::cerr << "setsockopt(SO_BUSY_POLL) failed: " << errno << " (CAP_NET_ADMIN 필요할 수 있음)" << std::endl;
+            }
+        }
+#endif
     }
 
-    // SessionManager에 Session 등록
+    // SessionManager에 Session 등록 (핸들 발급 - 백엔드 등록 시 CompletionKey로 사용)
     if (!server_->AddSession(session)) {
         std::cerr << "Failed to add session to SessionManager" << std::endl;
-        closesocket(clientSocket);
+        session->Close(); // 소켓은 Session이 닫음 (이중 close 방지)
         return;
     }
 
+    // I/O 백엔드에 소켓 연결
+    if (!AssociateSocket(clientSocket, session.get())) {
+        std::cerr << "Failed to associate client socket with I/O backend" << std::endl;
+        session->Close();
+        return;
+    }
+
+    // 인증 제한 시간 등록 (이후 기한은 수신 시각과 상태로 계산)
+    shards_[shardIndex]->GetTimers().Schedule(session->GetHandle(), session->GetIdleTimeoutMs());
+
+    ++acceptedCount_;
+
     // 첫 번째 Recv 요청
     if (!session->Initialize()) {
         std::cerr << "Failed to initialize session for new client" << std::endl;
@@ -202,97 +357,393 @@ void NetworkManager::HandleNewClient(SOCKET clientSocket, const sockaddr_in& cli
     }
 
     // LOG
-    std::cout << "New client connected: " << inet_ntoa(clientAddr.sin_addr) 
-              << ":" << ntohs(clientAddr.sin_port) << std::endl;
+    if (clientAddr.sin_family == AF_INET) {
+        std::cout << "New client connected: " << inet_ntoa(clientAddr.sin_addr) 
+                  << ":" << ntohs(clientAddr.sin_port) << std::endl;
+    } else {
+        std::cout << "New client connected: local (" << unixSocketPath_ << ")" << std::endl;
+    }
+}
+
+SOCKET NetworkManager::CreateUnixListenSocket(const std::string& path) {
+#ifdef _WIN32
+    std::cerr << "Unix domain socket listener is not supported on Windows: " << path << std::endl;
+    return INVALID_SOCKET;
+#else
+    sockaddr_un addr = {};
+    if (path.empty() || path.size() >= sizeof(addr.sun_path)) {
+        std::cerr << "Invalid unix socket path: " << path << std::endl;
+        return INVALID_SOCKET;
+    }
+    addr.sun_family = AF_UNIX;
+    memcpy(addr.sun_path, path.c_str(), path.size());
+
+    SOCKET listenSocket = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+    if (listenSocket == INVALID_SOCKET) {
+        std::cerr << "Failed to create unix socket: " << WSAGetLastError() << std::endl;
+        return INVALID_SOCKET;
+    }
+
+    // 이전 실행(또는 인계 전 프로세스)이 남긴 경로는 지우고 새로 바인드
+    unlink(path.c_str());
+    if (bind(listenSocket, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) == SOCKET_ERROR) {
+        std::cerr << "bind failed on " << path << ": " << WSAGetLastError() << std::endl;
+        closesocket(listenSocket);
+        return INVALID_SOCKET;
+    }
+
+    if (listen(listenSocket, SOMAXCONN) == SOCKET_ERROR) {
+        std::cerr << "listen failed on " << path << ": " << WSAGetLastError() << std::endl;
+        closesocket(listenSocket);
+        unlink(path.c_str());
+        return INVALID_SOCKET;
+    }
+
+    struct stat info = {};
+    unixSocketInode_ = (stat(path.c_str(), &info) == 0) ? static_cast<uint64_t>(info.st_ino) : 0;
+
+    std::cout << "Listen socket created on " << path << std::endl;
+    return listenSocket;
+#endif
+}
+
+void NetworkManager::CloseUnixListenSocket() {
+    if (unixListenSocket_ == INVALID_SOCKET) return;
+
+#ifndef _WIN32
+    // 경로가 아직 이 소켓을 가리킬 때만 지움 (인계 후에는 새 프로세스가 같은 경로에 다시 바인드함)
+    struct stat current = {};
+    if (unixSocketInode_ != 0 && stat(unixSocketPath_.c_str(), &current) == 0 &&
+        static_cast<uint64_t>(current.st_ino) == unixSocketInode_) {
+        unlink(unixSocketPath_.c_str());
+    }
+#endif
+    closesocket(unixListenSocket_);
+    unixListenSocket_ = INVALID_SOCKET;
 }
 
 bool NetworkManager::StartAccept() {
-    // Accept 전용 스레드 생성
-
-    acceptThread_ = std::thread([this]() {
-        while (isRunning_) {
-            sockaddr_in clientAddr;
-            int clientAddrLen = sizeof(clientAddr);
-
-            // 클라이언트 연결 대기
-            SOCKET clientSocket = accept(listenSocket_, reinterpret_cast<sockaddr*>(&clientAddr), &clientAddrLen);
-            if (clientSocket == INVALID_SOCKET) {
-                if (isRunning_) {
-                    std::cerr << "accept failed: " << WSAGetLastError() << std::endl;
-                }
-                continue;
-            }
+    // 리슨 소켓마다 accept를 여러 개 미리 걸어둠 - 완료를 받은 워커가 세션 설정까지 바로 처리
+    // 리슨 소켓 i는 샤드 i가 받음 - 리슨 소켓이 샤드보다 적으면(Windows) 수락한 소켓을 샤드에 나눠줌
+    int perListener = std::max<int>(1, PENDING_ACCEPT_COUNT / static_cast<int>(listenSockets_.size()));
+    int posted = 0;
+    acceptHandoff_ = listenSockets_.size() < shards_.size();
+
+    for (size_t i = 0; i < listenSockets_.size(); ++i) {
+        Shard* shard = shards_[i % shards_.size()].get();
+        if (!shard->GetBackend()->Associate(listenSockets_[i], SessionHandle())) {
+            std::cerr << "Failed to associate listen socket with I/O backend" << std::endl;
+            return false;
+        }
 
-            // 새 클라이언트 처리
-            HandleNewClient(clientSocket, clientAddr);
+        for (int j = 0; j < perListener; ++j) {
+            if (PostAccept(listenSockets_[i], shard)) ++posted;
         }
-    });
+    }
+
+    // Unix 도메인 소켓 리스너는 샤드 0이 받고 수락한 연결은 샤드에 나눠줌 (실패해도 TCP는 계속 사용)
+    if (!unixSocketPath_.empty()) {
+        unixListenSocket_ = CreateUnixListenSocket(unixSocketPath_);
+        if (unixListenSocket_ != INVALID_SOCKET &&
+            !shards_.front()->GetBackend()->Associate(unixListenSocket_, SessionHandle())) {
+            std::cerr << "Failed to associate unix listen socket with I/O backend" << std::endl;
+            CloseUnixListenSocket();
+        }
+        for (int j = 0; unixListenSocket_ != INVALID_SOCKET && j < perListener; ++j) {
+            if (PostAccept(unixListenSocket_, shards_.front().get())) ++posted;
+        }
+    }
+
+    if (posted == 0) {
+        std::cerr << "Failed to post accept" << std::endl;
+        return false;
+    }
 
-    std::cout << "Accept thread started" << std::endl;
+    accepting_ = true;
+    std::cout << "Accept started (listen sockets: " << listenSockets_.size()
+              << ", pending accepts: " << posted << ")" << std::endl;
     return true;
 }
 
-bool NetworkManager::AssociateSocketWithIOCP(SOCKET socket, Session* session) {
-    // Client 소켓을 생성된 IOCP에 연결
-    HANDLE result = CreateIoCompletionPort(
-        reinterpret_cast<HANDLE>(socket), // 소켓 핸들
-        iocpHandle_,                      // 기존 IOCP 핸들
-        reinterpret_cast<ULONG_PTR>(session), // CompletionKey로 Session 포인터 전달
-        0                                 // 동시 실행 스레드 수 (0 = 시스템이 결정)
-    );
+void NetworkManager::StopAccepting() {
+    if (!accepting_.exchange(false)) return;
+
+    // 백엔드 등록만 해제 - 걸어둔 accept는 정리되고, 소켓 자체는 새 프로세스가 계속 받음
+    for (size_t i = 0; i < listenSockets_.size(); ++i) {
+        if (!shards_.empty()) {
+            DissociateSocket(listenSockets_[i], static_cast<int>(i % shards_.size()));
+        }
+    }
+    // Unix 소켓 경로는 새 프로세스가 다시 바인드했으므로 이 프로세스 것은 더 이상 새 연결을 받지 않음
+    if (unixListenSocket_ != INVALID_SOCKET && !shards_.empty()) {
+        DissociateSocket(unixListenSocket_, 0);
+    }
+    std::cout << "Accept stopped (listen sockets handed off: " << listenSockets_.size() << ")" << std::endl;
+}
+
+bool NetworkManager::PostAccept(SOCKET listenSocket, Shard* shard) {
+    auto acceptOverlapped = IoContextPool::Acquire(IOOperation::ACCEPT, ACCEPT_BUFFER_SIZE);
+    if (!acceptOverlapped) return false;
 
-    if (result != iocpHandle_) {
-        std::cerr << "CreateIoCompletionPort (associate) failed: " << GetLastError() << std::endl;
+    // 즉시 실패 시 소유권은 호출자에게 남음
+    if (!shard->GetBackend()->PostAccept(listenSocket, acceptOverlapped)) {
+        IoContextPool::Release(acceptOverlapped);
         return false;
     }
+    return true;
+}
+
+void NetworkManager::ProcessAccept(Shard* shard, bool success, OverlappedEx* overlapped) {
+    SOCKET listenSocket = overlapped->listenSocket;
+    SOCKET clientSocket = overlapped->acceptSocket;
+    sockaddr_in clientAddr;
+    memcpy(&clientAddr, overlapped->buffer, sizeof(clientAddr));
+    IoContextPool::Release(overlapped);
 
-    return true;   
+    // 종료 중이면 새 연결은 받지 않음
+    if (!isRunning_) {
+        if (clientSocket != INVALID_SOCKET) closesocket(clientSocket);
+        return;
+    }
+
+    // 세션 설정 전에 다음 accept부터 다시 걸어 연결이 몰려도 대기 중인 accept가 줄지 않게 함
+    // (리슨 소켓을 넘긴 뒤면 다시 걸지 않음 - 이미 수락한 이 연결은 계속 처리)
+    if (accepting_ && !PostAccept(listenSocket, shard)) {
+        std::cerr << "accept 재요청 실패 (리슨 소켓: " << listenSocket << ")" << std::endl;
+    }
+
+    if (!success || clientSocket == INVALID_SOCKET) {
+        std::cerr << "accept failed" << std::endl;
+        if (clientSocket != INVALID_SOCKET) closesocket(clientSocket);
+        return;
+    }
+
+    // 수락 제어 - 세션을 만들기 전에 판단해서 거절 비용을 최소화
+    Admission admission = AdmitConnection();
+    if (admission != Admission::ACCEPT) {
+        if (admission == Admission::BUSY) {
+            // 새 소켓의 송신 버퍼는 비어 있으므로 블로킹 없이 바로 들어감 (실패해도 그냥 닫음)
+            static const char busyFrame[] = PKT_SERVER_BUSY "\n";
+            send(clientSocket, busyFrame, static_cast<int>(sizeof(busyFrame) - 1), 0);
+            ++busyCount_;
+        } else {
+            ++rejectedCount_;
+        }
+        closesocket(clientSocket);
+        return;
+    }
+
+    // 새 클라이언트 처리 (완료를 받은 워커에서 바로 진행, 넘겨줄 샤드가 있으면 그 샤드에서)
+    int shardIndex = (acceptHandoff_ || listenSocket == unixListenSocket_) ? NextShard() : shard->GetIndex();
+    if (Shard::CurrentIndex() == shardIndex) {
+        // 같은 샤드면 작업 객체 없이 바로 (캡처가 std::function 내부 버퍼보다 커서 감싸면 힙 할당)
+        HandleNewClient(clientSocket, clientAddr, shardIndex);
+        return;
+    }
+    RunOnShard(shardIndex, [this, clientSocket, clientAddr, shardIndex]() {
+        HandleNewClient(clientSocket, clientAddr, shardIndex);
+    });
+}
+
+void NetworkManager::SetConnectionLimits(int hardLimit, int softLimit) {
+    maxConnections_ = std::max<int>(hardLimit, 1);
+    softConnections_ = std::min<int>(std::max<int>(softLimit, 1), maxConnections_);
+    std::cout << "Connection limits: max=" << maxConnections_ << ", busy above " << softConnections_ << std::endl;
+}
+
+NetworkManager::Admission NetworkManager::AdmitConnection() const {
+    // 다른 샤드로 넘겨 아직 세션이 되지 않은 연결은 세지 않으므로 상한은 근사값
+    size_t connections = server_ ? server_->GetSessionCount() : 0;
+    if (connections >= static_cast<size_t>(maxConnections_)) return Admission::REJECT;
+    if (connections >= static_cast<size_t>(softConnections_)) return Admission::BUSY;
+    if (overloaded_.load(std::memory_order_relaxed)) return Admission::BUSY;
+    return Admission::ACCEPT;
+}
+
+void NetworkManager::UpdateOverload(int64_t nowMs) {
+    int64_t worst = 0;
+    for (auto& shard : shards_) {
+        worst = std::max<int64_t>(worst, shard->GetLatencyMs(nowMs));
+        shard->ProbeLatency(nowMs);
+    }
+
+    // 경계 근처에서 켜졌다 꺼졌다 하지 않도록 켜는 기준과 끄는 기준을 다르게 둠
+    bool overloaded = overloaded_.load(std::memory_order_relaxed);
+    if (!overloaded && worst > SHED_LATENCY_MS) {
+        overloaded_ = true;
+        std::cerr << "[Admission] 워커 지연 " << worst << "ms - 새 연결을 SERVER_BUSY로 돌려보냄" << std::endl;
+    } else if (overloaded && worst < SHED_RECOVER_MS) {
+        overloaded_ = false;
+        std::cout << "[Admission] 워커 지연 " << worst << "ms - 새 연결 수락 재개" << std::endl;
+    }
+}
+
+bool NetworkManager::AssociateSocket(SOCKET socket, Session* session) {
+    // Client 소켓을 소유 샤드의 I/O 백엔드에 연결 (CompletionKey로 세션 핸들 전달)
+    if (!session || session->GetShardIndex() >= static_cast<int>(shards_.size())) return false;
+    return shards_[session->GetShardIndex()]->GetBackend()->Associate(socket, session->GetHandle());
 }
 
-void NetworkManager::WorkerThreads() {
-    DWORD bytesTransferred;
-    ULONG_PTR completionKey;
-    LPOVERLAPPED overlapped;
+void NetworkManager::DissociateSocket(SOCKET socket, int shardIndex) {
+    if (shardIndex < static_cast<int>(shards_.size())) {
+        shards_[shardIndex]->GetBackend()->Dissociate(socket);
+    }
+}
+
+bool NetworkManager::PostRecv(SOCKET socket, OverlappedEx* overlapped, int shardIndex) {
+    return shardIndex < static_cast<int>(shards_.size()) &&
+           shards_[shardIndex]->GetBackend()->PostRecv(socket, overlapped);
+}
+
+bool NetworkManager::PostSend(SOCKET socket, OverlappedEx* overlapped, int shardIndex) {
+    return shardIndex < static_cast<int>(shards_.size()) &&
+           shards_[shardIndex]->GetBackend()->PostSend(socket, overlapped);
+}
+
+void NetworkManager::RunOnShard(int shardIndex, std::function<void()> task) {
+    // 샤드 상태(게임방 등)는 그 샤드의 워커만 다루도록 워커가 아닌 스레드에서 온 작업도 넘김
+    if (Shard::CurrentIndex() == shardIndex) {
+        task();
+        return;
+    }
+    shards_[shardIndex]->Post(std::move(task));
+}
+
+int NetworkManager::NextShard() {
+    return static_cast<int>(nextShard_.fetch_add(1, std::memory_order_relaxed) % shards_.size());
+}
+
+void NetworkManager::WorkerThreads(Shard* shard, int pinnedCore) {
+    Shard::SetCurrentIndex(shard->GetIndex());
+    if (pinnedCore >= 0) {
+        PinCurrentThread(pinnedCore);
+    }
+
+    IOCompletion completions[IOBackend::MAX_COMPLETION_BATCH];
+    int count = 0;
+
+    // 완료 처리 중(ReaderBusy ~ ReaderIdle)에는 핸들로 얻은 Session*가 해제되지 않음
+    int reader = sessions_->RegisterReader();
+    sessions_->ReaderBusy(reader);
+    std::vector<SessionHandle> expired; // 타임아웃 확인용 (워커마다 재사용)
+    std::vector<SessionHandle> sendBatch; // 이번 배치에서 송신할 세션 (워커마다 재사용)
 
     while (isRunning_) {
-        // IOCP에서 완료된 소켓 I/O 작업 가져오기
-        BOOL result = GetQueuedCompletionStatus(
-            iocpHandle_,               // IOCP 핸들
-            &bytesTransferred,         // 전송된 바이트 수
-            &completionKey,           // CompletionKey (Session* 포인터)
-            &overlapped,              // OVERLAPPED 구조체
-            INFINITE                  // 대기 시간 (무한대기)
-        );
-
-        // 종료 신호 확인 (소멸자에서 PostQueuedCompletionStatus(0, 0, nullptr) 호출)
-        if (!result && overlapped == nullptr) {
+        // 배치 시작 - 여기서부터 생긴 송신은 세션별로 모아두었다가 배치 끝에서 한 번에 보냄
+        t_sendBatch = &sendBatch;
+
+        // 다른 샤드가 넘긴 작업(송신, 게임 패킷 등) 먼저 처리
+        shard->RunPending();
+        CheckTimeouts(shard, expired);
+
+        // 지난 대기에서 가져온 완료를 연속으로 처리
+        for (int i = 0; i < count; ++i) {
+            IOCompletion& completion = completions[i];
+            if (!completion.overlapped) continue;
+
+            // accept 완료는 세션이 없으므로 따로 처리
+            if (completion.overlapped->operation == IOOperation::ACCEPT) {
+                ProcessAccept(shard, completion.success, completion.overlapped);
+                continue;
+            }
+
+            // 핸들 -> 세션 (이미 제거된 세션이면 세대가 달라 nullptr, 완료는 버림)
+            Session* session = sessions_->Resolve(completion.session);
+
+            if (!completion.success) {
+                // I/O 에러 발생 시
+                if (session) { // 세션 Close
+                    session->Close();
+                }
+
+                IoContextPool::Release(completion.overlapped); // OverlappedEx 풀에 반납
+                continue;
+            }
+
+            // 완료 패킷 처리
+            ProcessCompletionPacket(completion.bytesTransferred, session, completion.overlapped);
+        }
+
+        // 배치 끝 - 모아둔 송신 시작
+        t_sendBatch = nullptr;
+        FlushSendBatch(sendBatch);
+
+        // 백엔드에서 완료된 소켓 I/O 작업을 최대 completionBatch_개 가져오기 (종료 신호 시 false)
+        sessions_->ReaderIdle(reader);
+        if (!WaitCompletions(shard, completions, count)) {
             std::cout << "Worker thread terminating..." << std::endl;
             break;
         }
+        sessions_->ReaderBusy(reader);
+    }
 
-        // Session과 OverlappedEx 포인터 가져오기
-        auto session = reinterpret_cast<Session*>(completionKey);
-        auto overlappedEx = reinterpret_cast<OverlappedEx*>(overlapped);
+    sessions_->UnregisterReader(reader);
+}
 
-        if (!result) {
-            // I/O 에러 발생 시
-            DWORD error = GetLastError();
-            std::cerr << "I/O operation failed: " << error << std::endl;
+bool NetworkManager::WaitCompletions(Shard* shard, IOCompletion* completions, int& count) {
+    IOBackend* backend = shard->GetBackend();
+
+    // 바쁜 대기: 완료나 메일박스 작업이 생길 때까지 잠들지 않고 확인 (기다린 시간만큼만)
+    // (메일박스 깨우기 통지는 대기하지 않는 호출에서 그냥 소비되므로 메일박스는 직접 확인)
+    if (busyPollUs_ > 0) {
+        auto deadline = std::chrono::steady_clock::now() + std::chrono::microseconds(busyPollUs_);
+        do {
+            if (!backend->GetCompletions(completions, completionBatch_, count, false)) return false;
+            if (count > 0 || shard->HasPending()) return true;
+            CpuRelax();
+        } while (std::chrono::steady_clock::now() < deadline);
+    }
 
-            if (session) { // 세션 Close
-                session->Close();
-            }
+    return backend->GetCompletions(completions, completionBatch_, count);
+}
 
-            if (overlappedEx) { // OverlappedEx 메모리 해제
-                delete overlappedEx;
-            }
+bool NetworkManager::DeferSendFlush(Session* session) {
+    if (!t_sendBatch || !session) return false;
+
+    // 세션 맵에 등록되지 않은 세션은 배치 끝에서 찾을 수 없으므로 바로 송신
+    SessionHandle handle = session->GetHandle();
+    if (!handle.IsValid()) return false;
+
+    t_sendBatch->push_back(handle);
+    return true;
+}
+
+bool NetworkManager::InSendBatch() {
+    return t_sendBatch != nullptr;
+}
+
+void NetworkManager::FlushSendBatch(std::vector<SessionHandle>& batch) {
+    // 워커는 아직 ReaderBusy ~ ReaderIdle 사이이므로 조회한 Session*는 이 루프 동안 유효
+    for (SessionHandle handle : batch) {
+        if (Session* session = sessions_->Resolve(handle)) {
+            session->FlushDeferredSend();
+        }
+    }
+    batch.clear();
+}
+
+void NetworkManager::CheckTimeouts(Shard* shard, std::vector<SessionHandle>& expired) {
+    TimingWheel& timers = shard->GetTimers();
+    int64_t now = TimingWheel::NowMs();
+
+    // 지난 틱이 없으면 락 없이 바로 반환
+    expired.clear();
+    if (!timers.Advance(now, expired)) return;
+
+    for (SessionHandle handle : expired) {
+        Session* session = sessions_->Resolve(handle);
+        if (!session || session->IsClosed()) continue; // 이미 종료된 세션
+
+        int64_t remaining = session->GetLastActivityMs() + session->GetIdleTimeoutMs() - now;
+        if (remaining > 0) {
+            timers.Schedule(handle, std::min<int64_t>(remaining, TIMEOUT_RECHECK_MS));
             continue;
         }
 
-        // 완료 패킷 처리
-        ProcessCompletionPacket(bytesTransferred, session, overlappedEx);
+        std::cout << "세션 타임아웃 (소켓: " << session->GetSocket()
+                  << ", 상태: " << static_cast<int>(session->GetState()) << ")" << std::endl;
+        session->Close();
     }
-    
 }
 
 void NetworkManager::ProcessCompletionPacket(DWORD bytesTransferred, Session* session,
@@ -300,7 +751,7 @@ void NetworkManager::ProcessCompletionPacket(DWORD bytesTransferred, Session* se
     
     if (!session || !overlapped) {
         if (overlapped) {
-            delete overlapped; // 메모리 해제
+            IoContextPool::Release(overlapped); // 풀에 반납
         }
         return;
     }
@@ -308,16 +759,18 @@ void NetworkManager::ProcessCompletionPacket(DWORD bytesTransferred, Session* se
     // I/O 작업 종류에 따른 처리
     switch (overlapped->operation) {
     case IOOperation::RECV:
+        if (bytesTransferred > 0) ++recvCount_;
         // Pass overlapped buffer to Session so it can read the received bytes
         session->ProcessRecv(bytesTransferred, overlapped);
         break;
     
     case IOOperation::SEND:
+        sendCount_ += overlapped->SendBufferCount(); // 묶어 보낸 메시지 수
         session->ProcessSend(bytesTransferred);
         break;
     
     case IOOperation::ACCEPT:
-        // AcceptEx 사용 시 처리 (사용하지 않음)
+        // WorkerThreads에서 ProcessAccept로 처리 (여기로 오지 않음)
         break;
 
     default:
@@ -325,6 +778,68 @@ void NetworkManager::ProcessCompletionPacket(DWORD bytesTransferred, Session* se
         break;
     }
 
-    // OverlappedEx 메모리 해제
-    delete overlapped;
-}
\ No newline at end of file
+    // OverlappedEx를 delete하지 않고 풀에 반납 (다음 PostRecv/PostSend에서 재사용)
+    IoContextPool::Release(overlapped);
+}
+
+void NetworkManager::StatsThread() {
+    using namespace std::chrono;
+
+    uint64_t lastAccepted = 0, lastRecv = 0, lastSend = 0, lastHeapAlloc = 0, lastTurnedAway = 0;
+    auto lastTime = steady_clock::now();
+
+    std::unique_lock<std::mutex> lock(statsMutex_);
+    while (isRunning_) {
+        statsCv_.wait_for(lock, milliseconds(TimingWheel::TICK_MS), [this]() { return !isRunning_; });
+        if (!isRunning_) break;
+
+        // 완료가 없어 대기 중인 샤드도 타임아웃을 확인하도록 깨움 (틱이 지난 샤드만)
+        int64_t nowMs = TimingWheel::NowMs();
+        UpdateOverload(nowMs);
+        for (auto& shard : shards_) {
+            if (shard->GetTimers().IsDue(nowMs)) {
+                shard->GetBackend()->Wakeup();
+            }
+        }
+
+        auto now = steady_clock::now();
+        if (now - lastTime < seconds(STATS_INTERVAL_SEC)) continue;
+        double elapsed = duration<double>(now - lastTime).count();
+        uint64_t accepted = acceptedCount_.load();
+        uint64_t received = recvCount_.load();
+        uint64_t sent = sendCount_.load();
+        uint64_t heapAlloc = IoContextPool::GetHeapAllocCount();
+        uint64_t turnedAway = busyCount_.load() + rejectedCount_.load();
+
+        // 유휴 상태에서는 로그를 남기지 않음
+        if (accepted != lastAccepted || received != lastRecv || sent != lastSend || turnedAway != lastTurnedAway) {
+            // 연결당 메모리 = (세션 객체 + 재조립 버퍼 + 걸려있는/송신 중인 I/O 컨텍스트) / 세션 수
+            size_t sessionCount = sessions_ ? sessions_->Size() : 0;
+            int64_t sessionBytes = static_cast<int64_t>(sizeof(Session) * sessionCount + Session::GetRecvRingBytes()) +
+                                   IoContextPool::GetInUseBytes();
+
+            std::cout << "[Stats] backend=" << GetBackendName()
+                      << " conn/s=" << (accepted - lastAccepted) / elapsed
+                      << " recv msg/s=" << (received - lastRecv) / elapsed
+                      << " send msg/s=" << (sent - lastSend) / elapsed
+                      << " ctx alloc/s=" << (heapAlloc - lastHeapAlloc) / elapsed
+                      << " lagging=" << Session::GetLaggingCount()
+                      << " rate_limited=" << Session::GetRateLimitedCount()
+                      << " busy=" << busyCount_.load() << " rejected=" << rejectedCount_.load()
+                      << " pool=" << sessionPool_.GetInUse() << "/" << sessionPool_.GetCapacity()
+                      << " pool_peak=" << sessionPool_.GetHighWater() << " pool_overflow=" << sessionPool_.GetOverflowCount()
+                      << (overloaded_ ? " OVERLOADED" : "") << (accepting_ ? "" : " DRAINING")
+                      << " sessions=" << sessionCount
+                      << " mem/conn=" << (sessionCount ? sessionBytes / static_cast<int64_t>(sessionCount) : 0) << "B"
+                      << " (total conn=" << accepted
+                      << ", ctx reuse=" << IoContextPool::GetReuseCount() << ")" << std::endl;
+        }
+
+        lastAccepted = accepted;
+        lastRecv = received;
+        lastSend = sent;
+        lastHeapAlloc = heapAlloc;
+        lastTurnedAway = turnedAway;
+        lastTime = now;
+    }
+}
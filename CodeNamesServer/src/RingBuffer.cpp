@@ -0,0 +1,109 @@
+#include "RingBuffer.h"
+#include <algorithm>
+#include <cstring>
+
+RingBuffer::RingBuffer(size_t capacity)
+    : capacity_(capacity), head_(0), size_(0), scanned_(0) {
+}
+
+bool RingBuffer::ExtractFrame(const char*& data, size_t& length, char delimiter, std::string_view& frame) {
+    const char* found = static_cast<const char*>(memchr(data, delimiter, length));
+    if (!found) return false;
+
+    size_t frameLength = static_cast<size_t>(found - data);
+    frame = std::string_view(data, frameLength);
+    if (!frame.empty() && frame.back() == '\r') {
+        frame.remove_suffix(1);
+    }
+
+    data = found + 1;
+    length -= frameLength + 1;
+    return true;
+}
+
+bool RingBuffer::Write(const char* data, size_t length) {
+    if (length > FreeSpace()) return false;
+    if (length == 0) return true;
+    if (buffer_.empty()) buffer_.resize(capacity_);
+
+    // 끝부분과 앞부분 두 번에 나눠서 복사
+    size_t tail = (head_ + size_) % buffer_.size();
+    size_t first = std::min<size_t>(length, buffer_.size() - tail);
+    memcpy(buffer_.data() + tail, data, first);
+    memcpy(buffer_.data(), data + first, length - first);
+
+    size_ += length;
+    return true;
+}
+
+bool RingBuffer::ExtractFrame(char delimiter, std::string_view& frame) {
+    // 이전 호출에서 확인한 부분은 건너뛰고 구분자 탐색
+    size_t found = size_;
+    for (size_t i = scanned_; i < size_; ++i) {
+        if (buffer_[(head_ + i) % buffer_.size()] == delimiter) {
+            found = i;
+            break;
+        }
+    }
+
+    if (found == size_) {
+        scanned_ = size_;
+        return false;
+    }
+
+    size_t frameLength = found;
+    size_t first = std::min<size_t>(frameLength, buffer_.size() - head_);
+    if (first == frameLength) {
+        frame = std::string_view(buffer_.data() + head_, frameLength);
+    } else {
+        wrapped_.assign(buffer_.data() + head_, first);
+        wrapped_.append(buffer_.data(), frameLength - first);
+        frame = wrapped_;
+    }
+    if (!frame.empty() && frame.back() == '\r') {
+        frame.remove_suffix(1);
+    }
+
+    // 프레임 + 구분자 소비
+    head_ = (head_ + frameLength + 1) % buffer_.size();
+    size_ -= frameLength + 1;
+    scanned_ = 0;
+    if (size_ == 0) head_ = 0;
+    return true;
+}
+
+size_t RingBuffer::Peek(char* dst, size_t n) const {
+    size_t count = std::min(n, size_);
+    if (count == 0) return 0;
+
+    size_t first = std::min<size_t>(count, buffer_.size() - head_);
+    memcpy(dst, buffer_.data() + head_, first);
+    memcpy(dst + first, buffer_.data(), count - first);
+    return count;
+}
+
+std::string_view RingBuffer::Consume(size_t skip, size_t length) {
+    size_t start = (head_ + skip) % buffer_.size();
+    size_t first = std::min<size_t>(length, buffer_.size() - start);
+
+    std::string_view result;
+    if (first == length) {
+        result = std::string_view(buffer_.data() + start, length);
+    } else {
+        wrapped_.assign(buffer_.data() + start, first);
+        wrapped_.append(buffer_.data(), length - first);
+        result = wrapped_;
+    }
+
+    head_ = (head_ + skip + length) % buffer_.size();
+    size_ -= skip + length;
+    scanned_ = 0;
+    if (size_ == 0) head_ = 0;
+    return result;
+}
+
+void RingBuffer::Clear() {
+    head_ = 0;
+    size_ = 0;
+    scanned_ = 0;
+}
@@ -5,22 +5,138 @@
 #include "DatabaseManager.h"
 #include "IOCPServer.h"
 #include "PacketProtocol.h"
+#include "PacketOpcode.h"
+#include "PacketFields.h"
+#include "IoContextPool.h"
+#include "BinaryCodec.h"
 
 #include <iostream>
-#include <ws2tcpip.h>
 #include <ctime>
+#include <algorithm>
+#include <array>
+#include <atomic>
+
+namespace {
+    std::atomic<SlowConsumerPolicy> g_slowConsumerPolicy{ SlowConsumerPolicy::COLLAPSE };
+    std::atomic<size_t> g_laggingCount{ 0 };
+    std::atomic<RecvBufferMode> g_recvBufferMode{ RecvBufferMode::ON_DEMAND };
+    std::atomic<size_t> g_recvRingBytes{ 0 };
+    std::atomic<uint64_t> g_rateLimitedCount{ 0 };
+
+    // 분류별 기본 제한 (초당 토큰 / 최대 토큰) - 사람이 보내는 속도보다 넉넉하게
+    RateLimit g_rateLimits[static_cast<int>(RateClass::COUNT)] = {
+        { 2, 5 },  // AUTH
+        { 5, 10 }, // CHAT
+        { 2, 5 },  // ANSWER
+    };
+    const char* const RATE_CLASS_NAMES[static_cast<int>(RateClass::COUNT)] = { "auth", "chat", "answer" };  // 명령줄 / 설정 이름
+    const char* const RATE_CLASS_TOKENS[static_cast<int>(RateClass::COUNT)] = { "AUTH", "CHAT", "ANSWER" }; // RATE_LIMITED 응답 필드 (PacketProtocol.h)
+
+    // 바이너리 프레임 본문 최대 길이 (헤더 포함해도 MAX_FRAME_SIZE 미만 - 재조립 버퍼 길이 검사와 맞춤)
+    constexpr size_t BINARY_MAX_BODY = MAX_FRAME_SIZE - BinaryCodec::MAX_VARINT_BYTES;
+
+    bool HasPrefix(const std::string& frame, const std::string& prefix) {
+        return frame.compare(0, prefix.size(), prefix) == 0;
+    }
+
+    // 게임 진행에 꼭 필요한 메시지 (매칭 결과 ~ 게임 종료) - 송신이 밀린 수신자에게는 채팅이나 로비 응답보다 먼저 보냄
+    constexpr Opcode CRITICAL_OPCODES[] = {
+        Opcode::PROTO_OK, Opcode::WAIT_REPLY, Opcode::QUEUE_FULL, Opcode::GAME_START, Opcode::GAME_INIT, Opcode::ALL_CARDS,
+        Opcode::HINT, Opcode::CARD_UPDATE, Opcode::TURN_UPDATE, Opcode::ANSWER_RESULT, Opcode::GAME_OVER,
+    };
+
+    // opcode별 송신 우선순위 (나머지는 NORMAL)
+    constexpr auto OUTBOUND_PRIORITY = [] {
+        std::array<SendPriority, PacketOpcode::COUNT> priorities{};
+        for (SendPriority& priority : priorities) {
+            priority = SendPriority::NORMAL;
+        }
+        for (Opcode opcode : CRITICAL_OPCODES) {
+            priorities[static_cast<size_t>(opcode)] = SendPriority::CRITICAL;
+        }
+        priorities[static_cast<size_t>(Opcode::CHAT)] = SendPriority::LOW;
+        return priorities;
+    }();
+
+    // 최신 프레임이 이전 프레임을 대체하는 상태 메시지면 비교할 앞부분 길이 (아니면 0)
+    // - TURN_UPDATE|...         : 메시지 종류 전체가 하나의 상태
+    // - CARD_UPDATE|cardIndex|... : 카드마다 하나의 상태
+    size_t StateKeyLength(const std::string& frame) {
+        static const std::string turn = std::string(PKT_TURN_UPDATE) + "|";
+        static const std::string card = std::string(PKT_CARD_UPDATE) + "|";
+        if (HasPrefix(frame, turn)) return turn.size();
+        if (HasPrefix(frame, card)) {
+            size_t end = frame.find('|', card.size());
+            return end == std::string::npos ? 0 : end + 1;
+        }
+        return 0;
+    }
+}
 
 Session::Session(SOCKET sock, NetworkManager* networkmanager)
-    : socket_(sock), networkManager_(networkmanager), server_(nullptr),
+    : socket_(sock), networkManager_(networkmanager), shardIndex_(0), server_(nullptr),
       gameManager_(nullptr), userManager_(nullptr), username_(""),
-        currentState_(SessionState::AUTHENTICATING),
-      isClosed_(false)
+        isInMatchingQueue_(false), currentState_(SessionState::AUTHENTICATING),
+      isSending_(false), flushDeferred_(false), closeAfterSend_(false), queuedBytes_(0), inflightBytes_(0),
+      sendSequence_(0), sendFormat_(WireFormat::TEXT), recvFormat_(WireFormat::TEXT),
+      recvBuffer_(RECV_RING_SIZE),
+      isClosed_(sock == INVALID_SOCKET), // SessionPool이 미리 만드는 세션은 닫힌 상태로 대기
+      lastActivityMs_(TimingWheel::NowMs()), rateRejectStreak_(0)
 {
-    std::cout << "Session 생성: 소켓 " << socket_ << std::endl;
+    if (socket_ != INVALID_SOCKET) {
+        std::cout << "Session 생성: 소켓 " << socket_ << std::endl;
+    }
 }
 
 Session::~Session() {
     Close();
+    g_recvRingBytes -= recvBuffer_.AllocatedBytes();
+}
+
+void Session::Reuse(SOCKET sock) {
+    // 반납된 세션은 마지막 참조가 사라진 뒤이므로 다른 스레드가 접근하지 않음
+    socket_ = sock;
+    shardIndex_ = 0;
+    handle_ = SessionHandle();
+    gameManager_ = nullptr;
+    userManager_ = nullptr;
+    server_ = nullptr;
+
+    token_.clear();
+    username_.clear();
+    isInMatchingQueue_ = false;
+    currentState_ = SessionState::AUTHENTICATING;
+
+    {
+        std::lock_guard<std::mutex> lock(sendLock_);
+        ClearSendQueues();
+        isSending_ = false;
+        flushDeferred_ = false;
+        closeAfterSend_ = false;
+        inflightBytes_ = 0;
+        sendStats_ = SendStats();
+        sendFormat_ = WireFormat::TEXT;
+        formatSwitchFrame_.reset();
+    }
+    recvFormat_ = WireFormat::TEXT;
+    decodedPacket_.clear();
+    recvBuffer_.Clear();
+    for (TokenBucket& bucket : rateBuckets_) {
+        bucket = TokenBucket();
+    }
+    rateRejectStreak_ = 0;
+
+    userInfo_.id.clear();
+    userInfo_.nickname.clear();
+    userInfo_.wins = 0;
+    userInfo_.losses = 0;
+    userInfo_.report_count = 0;
+    userInfo_.is_suspended = false;
+    isLoggedIn_ = false;
+
+    Touch();
+    isClosed_ = false;
+    std::cout << "Session 생성: 소켓 " << socket_ << " (재사용)" << std::endl;
 }
 
 bool Session::Initialize() {
@@ -46,13 +162,29 @@ bool Session::Initialize() {
 }
 
 void Session::Close() {
-    if (isClosed_) return; // Close 중복 호출시 무시
+    if (isClosed_.exchange(true)) return; // Close 중복 호출시 무시 (정리는 처음 호출한 스레드만)
     std::cout << "Session 종료: 소켓 " << socket_ << std::endl; // 종료 시점 LOG 추가
-    isClosed_ = true;
 
-    // SessionManager에서 세션 제거
+    {
+        std::lock_guard<std::mutex> lock(sendLock_);
+        ClearSendQueues();
+        if (sendStats_.lagging) {
+            sendStats_.lagging = false;
+            --g_laggingCount;
+        }
+    }
+
+    // SessionManager가 마지막 shared_ptr을 놓더라도 Close가 끝날 때까지 유지
+    auto self = weak_from_this().lock();
+
+    // 백엔드에서 소켓 해제 (소켓 번호 재사용 전에 대기 중인 I/O 정리)
+    if (networkManager_ && socket_ != INVALID_SOCKET) {
+        networkManager_->DissociateSocket(socket_, shardIndex_);
+    }
+
+    // SessionManager에서 세션 제거 (핸들이 무효화되어 이후 도착한 완료는 버려짐)
     if (auto nm = GetNetworkManager()) {
-        nm->RemoveSession(socket_);
+        nm->RemoveSession(handle_);
     }
 
     if (socket_ != INVALID_SOCKET) {
@@ -61,87 +193,453 @@ void Session::Close() {
     }
 }
 
-// IOCP 비동기 수신 요청
+void Session::CloseAfterSend(const std::string& message) {
+    {
+        std::lock_guard<std::mutex> lock(sendLock_);
+        if (isClosed_ || closeAfterSend_) return;
+        closeAfterSend_ = true;
+    }
+
+    // 송신 완료(ProcessSend)에서 더 보낼 것이 없으면 닫음
+    if (!PostSend(message, SendPriority::CRITICAL)) {
+        Close();
+    }
+}
+
+// 비동기 수신 요청 (IOCP: WSARecv, epoll: 읽기 가능 시 recv)
 bool Session::PostRecv() {
-    // 데이터 수신을 위한 IOCP 오버랩 구조체 생성
-    auto recvOverlapped = new OverlappedEx(IOOperation::RECV);
-
-    // WSARecv 호출
-    DWORD flags = 0;
-    DWORD bytesReceived = 0;
-
-    int result = WSARecv(
-        socket_,                    // 소켓
-        &recvOverlapped->wsaBuf,    // 버퍼 정보
-        1,                          // 버퍼 개수
-        &bytesReceived,             // 받은 바이트 수
-        &flags,                     // 플래그
-        recvOverlapped,             // OVERLAPPED 구조체
-        nullptr                     // 완료 루틴 (사용 안함)
-    );
-
-    // 결과 처리 부분
-    if (result == SOCKET_ERROR) {
-        int error = WSAGetLastError();
-        if (error != WSA_IO_PENDING) {
-            // 실제 에러 발생
-            std::cerr << "WSARecv failed: " << error << std::endl;
-            delete recvOverlapped;
-            return false;
-        }
+    if (!networkManager_) return false;
 
-        // WSA_IO_PENDING: 비동기 작업이 진행 중일 경우
+    // 데이터 수신을 위한 오버랩 구조체 (풀에서 재사용)
+    // ON_DEMAND면 버퍼 없이 걸어두고 데이터가 도착했을 때 백엔드가 풀에서 버퍼를 붙임
+    size_t bufferSize = (g_recvBufferMode == RecvBufferMode::POSTED) ? SESSION_BUFFER_SIZE : 0;
+    auto recvOverlapped = IoContextPool::Acquire(IOOperation::RECV, bufferSize);
+    if (!recvOverlapped) return false;
+
+    // 즉시 실패 시 소유권은 호출자에게 남음
+    if (!networkManager_->PostRecv(socket_, recvOverlapped, shardIndex_)) {
+        IoContextPool::Release(recvOverlapped);
+        return false;
     }
 
     return true;
 }
 
-// IOCP 비동기 송신 요청
+// 비동기 송신 요청 (메시지 1개 = 프레임 1개, 끝에 구분자를 붙여 전송)
+// 송신은 세션당 1개만 진행하고, 그동안 들어온 메시지는 큐에 쌓았다가 완료 시 한 번에 모아 보냄
 bool Session::PostSend(const std::string& data) {
+    return PostSend(data, ClassifyOutbound(data));
+}
+
+bool Session::PostSend(const std::string& data, SendPriority priority) {
     // 데이터 크기 검사
     if (data.empty()) {
         std::cerr << "전송할 데이터가 비어있습니다." << std::endl;
         return false;
     }
 
-    if (data.size() > SESSION_BUFFER_SIZE) {
+    if (data.size() + 1 > SESSION_BUFFER_SIZE) {
         std::cerr << "데이터 크기가 버퍼 크기를 초과했습니다." << std::endl;
         return false;
     }
 
-    // OverlappedEx 구조체 생성 및 데이터 복사
-    auto sendOverlapped = new OverlappedEx(IOOperation::SEND);
-    memcpy(sendOverlapped->buffer, data.c_str(), data.size());
-    sendOverlapped->wsaBuf.len = static_cast<ULONG>(data.size());
-
-    // WSASend 호출
-    DWORD bytesSent = 0;
-    int result = WSASend(
-        socket_,                    // 소켓
-        &sendOverlapped->wsaBuf,    // 버퍼 정보
-        1,                          // 버퍼 개수
-        &bytesSent,                 // 전송된 바이트 수
-        0,                          // 플래그
-        sendOverlapped,             // OVERLAPPED 구조체
-        nullptr                     // 완료 루틴
-    );
-
-    // 결과 처리 부분
-    if (result == SOCKET_ERROR) {
-        int error = WSAGetLastError();
-        if (error != WSA_IO_PENDING) {
-            // 실제 에러 발생 - 에러 코드를 자세히 로깅
-            std::cerr << "WSASend failed: error=" << error << " (WSAGetLastError)" << std::endl;
-            delete sendOverlapped;
+    // 샤드 모드에서 다른 샤드(또는 워커가 아닌 스레드)가 보낸 메시지는 소유 샤드로 넘겨 처리
+    if (ForwardToOwnerShard(data, priority)) return true;
+
+    {
+        std::lock_guard<std::mutex> lock(sendLock_);
+        if (isClosed_) return false;
+
+        // 진행 중인 송신이 없고 작은 메시지면 큐(문자열 복사)를 거치지 않고 풀 버퍼에 바로 담아 송신
+        // (워커의 완료 배치 중에는 뒤이어 올 메시지와 모아 보내도록 큐로, 바이너리 연결은 변환해야 하므로 큐로)
+        if (sendFormat_ == WireFormat::TEXT && !isSending_ && queuedBytes_ == 0 && data.size() + 1 <= IoContextPool::SMALL_BUFFER_SIZE &&
+            !NetworkManager::InSendBatch()) {
+            auto sendOverlapped = IoContextPool::Acquire(IOOperation::SEND, data.size() + 1);
+            if (!sendOverlapped) return false;
+
+            memcpy(sendOverlapped->buffer, data.data(), data.size());
+            sendOverlapped->buffer[data.size()] = PKT_DELIMITER;
+            sendOverlapped->wsaBuf.len = static_cast<ULONG>(data.size() + 1);
+
+            if (!networkManager_ || !networkManager_->PostSend(socket_, sendOverlapped, shardIndex_)) {
+                IoContextPool::Release(sendOverlapped);
+                return false;
+            }
+            isSending_ = true;
+            inflightBytes_ = data.size() + 1;
+            return true;
+        }
+    }
+
+    return EnqueueSend(MakePayload(data), priority);
+}
+
+bool Session::PostSend(const SharedPayload& payload) {
+    return PostSend(payload, payload ? ClassifyOutbound(payload->text) : SendPriority::NORMAL);
+}
+
+bool Session::PostSend(const SharedPayload& payload, SendPriority priority) {
+    if (!payload || payload->text.empty()) {
+        std::cerr << "전송할 데이터가 비어있습니다." << std::endl;
+        return false;
+    }
+
+    if (payload->text.size() > SESSION_BUFFER_SIZE) {
+        std::cerr << "데이터 크기가 버퍼 크기를 초과했습니다." << std::endl;
+        return false;
+    }
+
+    if (ForwardToOwnerShard(payload, priority)) return true;
+
+    return EnqueueSend(payload, priority);
+}
+
+bool Session::PostSend(const OutboundFrames& frames) {
+    if (frames.empty()) return true;
+
+    // 다른 샤드에서 만든 묶음도 소유 샤드로 한 번만 넘김 (메시지마다 넘기지 않음)
+    if (ForwardToOwnerShard(frames)) return true;
+
+    size_t outstanding;
+    {
+        std::lock_guard<std::mutex> lock(sendLock_);
+        if (isClosed_) return false;
+
+        bool keep = true;
+        for (const OutboundFrame& frame : frames) {
+            if (!frame.payload || frame.payload->text.empty() || frame.payload->text.size() > SESSION_BUFFER_SIZE) {
+                std::cerr << "송신 묶음에 잘못된 메시지가 있어 건너뜁니다." << std::endl;
+                continue;
+            }
+            if (!EnqueueFrame(frame.payload, frame.priority)) {
+                keep = false;
+                break;
+            }
+        }
+        if (keep) return StartQueuedSend();
+        outstanding = queuedBytes_ + inflightBytes_;
+    }
+
+    return CloseSlowConsumer(outstanding);
+}
+
+bool Session::EnqueueSend(const SharedPayload& payload, SendPriority priority) {
+    size_t outstanding;
+    {
+        std::lock_guard<std::mutex> lock(sendLock_);
+        if (isClosed_) return false;
+
+        if (EnqueueFrame(payload, priority)) return StartQueuedSend();
+        outstanding = queuedBytes_ + inflightBytes_;
+    }
+
+    return CloseSlowConsumer(outstanding); // 락을 놓은 뒤 Close
+}
+
+bool Session::EnqueueFrame(const SharedPayload& payload, SendPriority priority) {
+    switch (ApplyBackpressure(payload->text, priority)) {
+    case OutboundAction::DROP:
+        return true; // 버린 메시지는 실패로 보지 않음
+    case OutboundAction::DISCONNECT:
+        return false;
+    case OutboundAction::ENQUEUE:
+        break;
+    }
+
+    sendQueues_[static_cast<int>(priority)].push_back({ payload, sendSequence_++ });
+    queuedBytes_ += payload->text.size();
+    sendStats_.peakBytes = std::max<size_t>(sendStats_.peakBytes, queuedBytes_ + inflightBytes_);
+    UpdateLagging(queuedBytes_ + inflightBytes_);
+    return true;
+}
+
+bool Session::StartQueuedSend() {
+    // 이미 송신 중이면 완료 후 ProcessSend에서 이어서 보냄 (전송 순서 보장)
+    if (isSending_ || flushDeferred_) return true;
+
+    // 워커가 완료 배치를 처리 중이면 배치 끝에서 이 세션에 쌓인 메시지를 한 번에 보냄
+    if (NetworkManager::DeferSendFlush(this)) {
+        flushDeferred_ = true;
+        return true;
+    }
+    return FlushSendQueue();
+}
+
+bool Session::CloseSlowConsumer(size_t outstanding) {
+    std::cerr << "느린 수신자 연결 종료 (소켓: " << socket_ << ", 송신 대기 "
+              << outstanding << " bytes)" << std::endl;
+    Close();
+    return false;
+}
+
+Session::OutboundAction Session::ApplyBackpressure(const std::string& frame, SendPriority priority) {
+    size_t outstanding = queuedBytes_ + inflightBytes_ + frame.size();
+    if (outstanding <= SEND_HIGH_WATER_BYTES) return OutboundAction::ENQUEUE;
+
+    UpdateLagging(outstanding);
+
+    SlowConsumerPolicy policy = g_slowConsumerPolicy.load(std::memory_order_relaxed);
+    if (policy == SlowConsumerPolicy::DISCONNECT) return OutboundAction::DISCONNECT;
+
+    // 채팅은 못 받아도 게임 진행에 지장이 없으므로 버림
+    if (priority == SendPriority::LOW) {
+        ++sendStats_.dropped;
+        return OutboundAction::DROP;
+    }
+
+    // 더 중요한 메시지가 밀리지 않도록 아직 보내지 않은 채팅도 비움
+    DropQueued(SendPriority::LOW);
+
+    // 아직 보내지 않은 이전 상태는 새 상태로 대체 (최신 상태만 전달하면 충분)
+    size_t keyLength = (policy == SlowConsumerPolicy::COLLAPSE) ? StateKeyLength(frame) : 0;
+    if (keyLength > 0) {
+        auto& queue = sendQueues_[static_cast<int>(priority)];
+        for (auto it = queue.begin(); it != queue.end();) {
+            if (it->payload->text.compare(0, keyLength, frame, 0, keyLength) == 0) {
+                queuedBytes_ -= it->payload->text.size();
+                ++sendStats_.collapsed;
+                it = queue.erase(it);
+            } else {
+                ++it;
+            }
+        }
+    }
+    outstanding = queuedBytes_ + inflightBytes_ + frame.size();
+
+    return outstanding > SEND_HARD_LIMIT_BYTES ? OutboundAction::DISCONNECT : OutboundAction::ENQUEUE;
+}
+
+void Session::DropQueued(SendPriority priority) {
+    auto& queue = sendQueues_[static_cast<int>(priority)];
+    for (const QueuedSend& queued : queue) {
+        queuedBytes_ -= queued.payload->text.size();
+    }
+    sendStats_.dropped += queue.size();
+    queue.clear();
+}
+
+void Session::ClearSendQueues() {
+    for (auto& queue : sendQueues_) {
+        queue.clear();
+    }
+    queuedBytes_ = 0;
+}
+
+void Session::UpdateLagging(size_t outstanding) {
+    // 상한을 넘으면 느린 수신자로 표시하고, 절반 아래로 빠지면 해제 (경계에서 반복 로그 방지)
+    if (!sendStats_.lagging && outstanding > SEND_HIGH_WATER_BYTES) {
+        sendStats_.lagging = true;
+        ++g_laggingCount;
+        std::cerr << "느린 수신자 감지 (소켓: " << socket_ << ", 송신 대기 " << outstanding << " bytes)" << std::endl;
+    } else if (sendStats_.lagging && outstanding < SEND_HIGH_WATER_BYTES / 2) {
+        sendStats_.lagging = false;
+        --g_laggingCount;
+        std::cout << "느린 수신자 해제 (소켓: " << socket_ << ", 버림 " << sendStats_.dropped
+                  << ", 대체 " << sendStats_.collapsed << ")" << std::endl;
+    }
+}
+
+SendStats Session::GetSendStats() const {
+    std::lock_guard<std::mutex> lock(sendLock_);
+    SendStats stats = sendStats_;
+    stats.outstandingBytes = queuedBytes_ + inflightBytes_;
+    return stats;
+}
+
+void Session::SetSlowConsumerPolicy(SlowConsumerPolicy policy) {
+    g_slowConsumerPolicy = policy;
+}
+
+SlowConsumerPolicy Session::GetSlowConsumerPolicy() {
+    return g_slowConsumerPolicy;
+}
+
+bool Session::ParseSlowConsumerPolicy(const std::string& name, SlowConsumerPolicy& policy) {
+    if (name == "disconnect") {
+        policy = SlowConsumerPolicy::DISCONNECT;
+    } else if (name == "drop") {
+        policy = SlowConsumerPolicy::DROP_CHAT;
+    } else if (name == "collapse") {
+        policy = SlowConsumerPolicy::COLLAPSE;
+    } else {
+        return false;
+    }
+    return true;
+}
+
+size_t Session::GetLaggingCount() {
+    return g_laggingCount;
+}
+
+void Session::SetRecvBufferMode(RecvBufferMode mode) {
+    g_recvBufferMode = mode;
+}
+
+RecvBufferMode Session::GetRecvBufferMode() {
+    return g_recvBufferMode;
+}
+
+bool Session::ParseRecvBufferMode(const std::string& name, RecvBufferMode& mode) {
+    if (name == "on-demand") {
+        mode = RecvBufferMode::ON_DEMAND;
+    } else if (name == "posted") {
+        mode = RecvBufferMode::POSTED;
+    } else {
+        return false;
+    }
+    return true;
+}
+
+size_t Session::GetRecvRingBytes() {
+    return g_recvRingBytes;
+}
+
+void Session::SetRateLimit(RateClass rateClass, RateLimit limit) {
+    g_rateLimits[static_cast<int>(rateClass)] = limit;
+}
+
+RateLimit Session::GetRateLimit(RateClass rateClass) {
+    return g_rateLimits[static_cast<int>(rateClass)];
+}
+
+bool Session::ParseRateLimit(const std::string& spec) {
+    if (spec == "off") {
+        for (int i = 0; i < static_cast<int>(RateClass::COUNT); ++i) {
+            g_rateLimits[i] = RateLimit();
+        }
+        return true;
+    }
+
+    // 분류=초당/최대 (최대 생략 시 초당 값과 같음)
+    size_t equal = spec.find('=');
+    if (equal == std::string::npos) return false;
+
+    std::string_view name(spec.data(), equal);
+    std::string_view value(spec.data() + equal + 1, spec.size() - equal - 1);
+    for (int i = 0; i < static_cast<int>(RateClass::COUNT); ++i) {
+        if (name != RATE_CLASS_NAMES[i]) continue;
+
+        int perSec = 0;
+        int burst = 0;
+        size_t slash = value.find('/');
+        if (!Packet::ParseInt(value.substr(0, slash), perSec) || perSec < 0) return false;
+        if (slash == std::string_view::npos) {
+            burst = perSec;
+        } else if (!Packet::ParseInt(value.substr(slash + 1), burst) || burst <= 0) {
             return false;
         }
 
-        // WSA_IO_PENDING: 비동기 작업이 진행 중일 경우
+        g_rateLimits[i].perSec = static_cast<uint32_t>(perSec);
+        g_rateLimits[i].burst = static_cast<uint32_t>(burst);
+        return true;
     }
+    return false;
+}
+
+uint64_t Session::GetRateLimitedCount() {
+    return g_rateLimitedCount;
+}
 
+template<typename... Args>
+bool Session::ForwardToOwnerShard(const Args&... args) {
+    if (!networkManager_ || networkManager_->IsOnShard(shardIndex_)) return false;
+
+    // 작업이 실행될 때까지 세션 유지 (shared_ptr로 관리되지 않는 세션은 그대로 진행)
+    auto self = weak_from_this().lock();
+    if (!self) return false;
+
+    networkManager_->RunOnShard(shardIndex_, [self, args...]() { self->PostSend(args...); });
     return true;
 }
 
+const std::string& OutboundPayload::Binary() const {
+    std::call_once(binaryOnce_, [this] {
+        std::string_view frame(text);
+        frame.remove_suffix(1); // 구분자
+        BinaryCodec::Encode(frame, BinaryCodec::Direction::TO_CLIENT, binary_);
+    });
+    return binary_;
+}
+
+SharedPayload Session::MakePayload(const std::string& message) {
+    auto payload = std::make_shared<OutboundPayload>();
+    payload->text.reserve(message.size() + 1);
+    payload->text.append(message);
+    payload->text.push_back(PKT_DELIMITER);
+    return payload;
+}
+
+SendPriority Session::ClassifyOutbound(std::string_view frame) {
+    if (!frame.empty() && frame.back() == PKT_DELIMITER) {
+        frame.remove_suffix(1); // 송신 프레임 (구분자 포함)
+    }
+
+    std::string_view fields;
+    bool hasFields = false;
+    return OUTBOUND_PRIORITY[static_cast<size_t>(PacketOpcode::Lookup(frame, fields, hasFields))];
+}
+
+bool Session::FlushSendQueue() {
+    if (queuedBytes_ == 0 || !networkManager_) return true;
+
+    auto sendOverlapped = IoContextPool::Acquire(IOOperation::SEND, 0);
+    if (!sendOverlapped) return false;
+
+    // 큐에 쌓인 프레임을 최대 MAX_SEND_GATHER개까지 하나의 송신 요청으로 묶음 (참조만 옮기고 복사 없음)
+    // 평소에는 넣은 순서 그대로, 송신 대기가 상한을 넘은 느린 수신자에게만 높은 등급부터
+    // 바이너리 연결은 메시지마다 한 번 변환해 둔 바이너리 프레임을 묶음 (PROTO_OK 앞까지는 텍스트 그대로)
+    bool byPriority = queuedBytes_ + inflightBytes_ > SEND_HIGH_WATER_BYTES;
+    size_t buffers = 0;
+    size_t bytes = 0;     // 큐에서 뺀 텍스트 바이트 (queuedBytes_ 기준)
+    size_t wireBytes = 0; // 실제로 보내는 바이트
+    sendOverlapped->sendPayloads.reserve(MAX_SEND_GATHER);
+    while (buffers < MAX_SEND_GATHER) {
+        auto* queue = NextSendQueue(byPriority);
+        if (!queue) break;
+
+        SharedPayload payload = std::move(queue->front().payload);
+        queue->pop_front();
+        bytes += payload->text.size();
+
+        const std::string& wire = (sendFormat_ == WireFormat::BINARY) ? payload->Binary() : payload->text;
+        if (payload == formatSwitchFrame_) {
+            sendFormat_ = WireFormat::BINARY;
+            formatSwitchFrame_.reset();
+        }
+        sendOverlapped->sendBufs[buffers].buf = const_cast<char*>(wire.data());
+        sendOverlapped->sendBufs[buffers].len = static_cast<ULONG>(wire.size());
+        wireBytes += wire.size();
+        ++buffers;
+        sendOverlapped->sendPayloads.push_back(std::move(payload));
+    }
+    sendOverlapped->sendBufCount = static_cast<DWORD>(buffers);
+
+    // 백엔드로 송신 요청 (IOCP: WSASend, epoll: sendmsg, io_uring: SENDMSG)
+    if (!networkManager_->PostSend(socket_, sendOverlapped, shardIndex_)) {
+        IoContextPool::Release(sendOverlapped);
+        ClearSendQueues();
+        inflightBytes_ = 0;
+        isSending_ = false;
+        return false;
+    }
+
+    queuedBytes_ -= bytes;
+    inflightBytes_ = wireBytes;
+    isSending_ = true;
+    return true;
+}
+
+std::deque<Session::QueuedSend>* Session::NextSendQueue(bool byPriority) {
+    // 등급마다 넣은 순서대로 쌓이므로 각 큐의 맨 앞 중 순번이 가장 작은 것이 전체에서 가장 먼저 넣은 프레임
+    std::deque<QueuedSend>* next = nullptr;
+    for (auto& queue : sendQueues_) {
+        if (queue.empty()) continue;
+        if (byPriority) return &queue;
+        if (!next || queue.front().sequence < next->front().sequence) next = &queue;
+    }
+    return next;
+}
+
 void Session::ProcessRecv(size_t bytesTransferred, struct OverlappedEx* overlapped) {
     // 연결 종료 확인
     if (bytesTransferred == 0) {
@@ -150,18 +648,190 @@ void Session::ProcessRecv(size_t bytesTransferred, struct OverlappedEx* overlapp
         return;
     }
 
-    // 받은 데이터를 문자열로 변환
-    std::string receivedData;
-    if (overlapped && overlapped->wsaBuf.buf) {
-        // overlapped->buffer에 저장된 바이트를 string으로 복사
-        receivedData.assign(overlapped->buffer, overlapped->buffer + bytesTransferred);
-    } else {
-        // 안전하게 빈 문자열 처리
-        receivedData = std::string();
+    Touch();
+    int64_t nowMs = GetLastActivityMs();
+
+    if (!overlapped) {
+        Close();
+        return;
+    }
+
+    // 한 번의 수신에 여러 프레임 또는 프레임 일부가 올 수 있음
+    // 재조립 버퍼가 비어 있으면 받은 버퍼에서 바로 프레임을 꺼내고 남은 조각만 재조립 버퍼로 복사
+    const char* data = overlapped->buffer;
+    size_t remaining = bytesTransferred;
+    std::string_view packet; // 수신 버퍼 / 재조립 버퍼를 가리킴 (복사 없음)
+    if (recvBuffer_.Size() == 0) {
+        while (!isClosed_ && NextPacket(data, remaining, packet)) {
+            if (packet.empty() || !AdmitPacket(packet, nowMs)) continue;
+            DispatchPacket(packet);
+        }
+        if (isClosed_) return;
+    }
+
+    size_t allocated = recvBuffer_.AllocatedBytes();
+    if (!recvBuffer_.Write(data, remaining)) {
+        std::cerr << "수신 버퍼 초과 (소켓: " << socket_ << ")" << std::endl;
+        Close();
+        return;
+    }
+    g_recvRingBytes += recvBuffer_.AllocatedBytes() - allocated;
+
+    // 완성된 프레임을 모두 처리하고 남은 조각은 다음 수신을 기다림
+    while (!isClosed_ && NextBufferedPacket(packet)) {
+        if (packet.empty() || !AdmitPacket(packet, nowMs)) continue;
+        DispatchPacket(packet);
+    }
+    if (isClosed_) return;
+
+    // 구분자 없이 최대 프레임 길이를 넘으면 잘못된 클라이언트로 판단
+    // (바이너리는 헤더에서 본문 길이를 먼저 확인하므로 미완성 프레임이 이 길이에 닿지 않음)
+    if (recvBuffer_.Size() >= MAX_FRAME_SIZE) {
+        std::cerr << "프레임 길이 초과 (소켓: " << socket_ << ")" << std::endl;
+        Close();
+        return;
+    }
+
+    // 다음 수신 준비
+    if (!PostRecv()) {
+        std::cerr << "다음 수신 요청 실패" << std::endl;
+        Close();
+    }
+}
+
+bool Session::NextPacket(const char*& data, size_t& remaining, std::string_view& packet) {
+    // 협상 패킷을 처리한 직후부터 바이너리이므로 프레임마다 확인
+    if (recvFormat_ == WireFormat::TEXT) {
+        return RingBuffer::ExtractFrame(data, remaining, PKT_DELIMITER, packet);
+    }
+
+    std::string_view body;
+    switch (BinaryCodec::ExtractFrame(data, remaining, BINARY_MAX_BODY, body)) {
+        case BinaryCodec::FrameStatus::OK:
+            return DecodePacket(body, packet);
+        case BinaryCodec::FrameStatus::INCOMPLETE:
+            return false;
+        default:
+            std::cerr << "잘못된 바이너리 프레임 헤더 (소켓: " << socket_ << ")" << std::endl;
+            Close();
+            return false;
+    }
+}
+
+bool Session::NextBufferedPacket(std::string_view& packet) {
+    if (recvFormat_ == WireFormat::TEXT) {
+        return recvBuffer_.ExtractFrame(PKT_DELIMITER, packet);
+    }
+
+    char header[BinaryCodec::MAX_VARINT_BYTES];
+    size_t peeked = recvBuffer_.Peek(header, sizeof(header));
+    size_t headerBytes = 0;
+    size_t bodyLength = 0;
+    switch (BinaryCodec::ReadHeader(header, peeked, BINARY_MAX_BODY, headerBytes, bodyLength)) {
+        case BinaryCodec::FrameStatus::OK:
+            break;
+        case BinaryCodec::FrameStatus::INCOMPLETE:
+            return false;
+        default:
+            std::cerr << "잘못된 바이너리 프레임 헤더 (소켓: " << socket_ << ")" << std::endl;
+            Close();
+            return false;
+    }
+
+    if (recvBuffer_.Size() < headerBytes + bodyLength) return false;
+    return DecodePacket(recvBuffer_.Consume(headerBytes, bodyLength), packet);
+}
+
+bool Session::DecodePacket(std::string_view body, std::string_view& packet) {
+    if (!BinaryCodec::Decode(body, BinaryCodec::Direction::TO_SERVER, decodedPacket_)) {
+        std::cerr << "잘못된 바이너리 프레임 (소켓: " << socket_ << ", opcode "
+                  << static_cast<int>(static_cast<uint8_t>(body[0])) << ")" << std::endl;
+        Close();
+        return false;
+    }
+    packet = decodedPacket_;
+    return true;
+}
+
+void Session::NegotiateFormat(std::string_view format) {
+    bool binary = (format == PKT_PROTO_BINARY);
+    SharedPayload reply = MakePayload(std::string(PKT_PROTO_OK) + "|" + (binary ? PKT_PROTO_BINARY : PKT_PROTO_TEXT));
+
+    if (binary) {
+        {
+            std::lock_guard<std::mutex> lock(sendLock_);
+            formatSwitchFrame_ = reply; // 이 응답을 보내는 송신부터 바이너리
+        }
+        recvFormat_ = WireFormat::BINARY; // 이 패킷 뒤로 오는 바이트는 바이너리 프레임
+    }
+    std::cout << "Wire format: " << (binary ? "binary" : "text") << " (소켓: " << socket_ << ")" << std::endl;
+    PostSend(reply, SendPriority::CRITICAL);
+}
+
+bool Session::ClassifyPacket(std::string_view packet, RateClass& rateClass) const {
+    std::string_view fields;
+    switch (currentState_) {
+        case SessionState::AUTHENTICATING:
+            // 하트비트와 wire format 협상은 로그인 시도가 아님 (재접속 직후 인증 한도를 미리 쓰지 않도록)
+            if (packet == PKT_HEARTBEAT) return false;
+            if (recvFormat_ == WireFormat::TEXT && Packet::MatchType(packet, PKT_PROTO, fields)) return false;
+            rateClass = RateClass::AUTH;
+            return true;
+
+        case SessionState::IN_GAME:
+            switch (PacketOpcode::LookupCommand(packet, fields)) {
+                case Opcode::CHAT:
+                    rateClass = RateClass::CHAT;
+                    return true;
+                case Opcode::ANSWER:
+                case Opcode::HINT:
+                    rateClass = RateClass::ANSWER;
+                    return true;
+                default:
+                    return false;
+            }
+
+        default:
+            return false;
+    }
+}
+
+bool Session::AdmitPacket(std::string_view packet, int64_t nowMs) {
+    RateClass rateClass;
+    if (!ClassifyPacket(packet, rateClass)) return true;
+
+    int index = static_cast<int>(rateClass);
+    if (rateBuckets_[index].TryConsume(g_rateLimits[index], nowMs)) {
+        rateRejectStreak_ = 0;
+        return true;
+    }
+
+    // 거절 - 파싱/락/DB 없이 버림, 알림은 연속 거절의 첫 패킷에만
+    ++g_rateLimitedCount;
+    if (rateRejectStreak_++ == 0) {
+        PostSend(std::string(PKT_RATE_LIMITED) + "|" + RATE_CLASS_TOKENS[index]);
+    }
+    if (rateRejectStreak_ >= RATE_LIMIT_DISCONNECT_COUNT) {
+        std::cerr << "속도 제한 반복 초과로 연결 종료 (소켓: " << socket_ << ", 분류: "
+                  << RATE_CLASS_NAMES[index] << ")" << std::endl;
+        Close();
+    }
+    return false;
+}
+
+void Session::DispatchPacket(std::string_view receivedData) {
+    std::cout << "수신 패킷 (" << receivedData.size() << " bytes): " << receivedData << std::endl;
+
+    // 하트비트는 수신 시각 갱신이 전부 (ProcessRecv에서 이미 처리)
+    if (receivedData == PKT_HEARTBEAT) return;
+
+    // wire format 협상 (텍스트 연결에서만, 상태와 무관)
+    std::string_view format;
+    if (recvFormat_ == WireFormat::TEXT && Packet::MatchType(receivedData, PKT_PROTO, format)) {
+        NegotiateFormat(format);
+        return;
     }
 
-    std::cout << "수신 데이터 (" << bytesTransferred << " bytes): " << receivedData << std::endl;
-    
     // 상태별 패킷 처리 분배
     switch (currentState_) {
         case SessionState::AUTHENTICATING:
@@ -183,7 +853,19 @@ void Session::ProcessRecv(size_t bytesTransferred, struct OverlappedEx* overlapp
             // GameManager에 위임
             if (auto gm = GetGameManager()) {
                 // 실제 게임 로직이 구현된 GameManager가 있으면 전달
-                gm->HandleGamePacket(this, receivedData);
+                if (networkManager_ && !networkManager_->IsOnShard(gm->GetShardIndex())) {
+                    // 샤드 모드: 게임방 상태는 게임방 소유 샤드에서만 다룸
+                    // (도착했을 때 이미 게임이 끝나 세션이 방을 떠났으면 버림)
+                    // 패킷이 수신 버퍼보다 오래 살아야 하므로 이때만 복사
+                    auto self = shared_from_this();
+                    networkManager_->RunOnShard(gm->GetShardIndex(), [self, gm, packet = std::string(receivedData)]() {
+                        if (self->GetGameManager() == gm && !self->IsClosed()) {
+                            gm->HandleGamePacket(self.get(), packet);
+                        }
+                    });
+                } else {
+                    gm->HandleGamePacket(this, receivedData);
+                }
             } else {
                 // GameManager가 할당되지 않은 경우(예: 아직 매칭 미완료 등)
                 std::cout << "[GAME] 패킷 처리: GameManager 미할당 - " << receivedData << std::endl;
@@ -195,16 +877,57 @@ void Session::ProcessRecv(size_t bytesTransferred, struct OverlappedEx* overlapp
             std::cerr << "Unknown session state" << std::endl;
             break;
     }
-    
-    // 다음 수신 준비
-    if (!PostRecv()) {
-        std::cerr << "다음 수신 요청 실패" << std::endl;
-        Close();
+}
+
+int64_t Session::GetIdleTimeoutMs() const {
+    switch (currentState_) {
+        case SessionState::AUTHENTICATING:
+            return AUTH_TIMEOUT_MS;
+        case SessionState::WAITING_MATCH:
+        case SessionState::IN_LOBBY:
+            return LOBBY_IDLE_TIMEOUT_MS;
+        case SessionState::IN_GAME:
+            return GAME_HEARTBEAT_TIMEOUT_MS;
+        default:
+            return AUTH_TIMEOUT_MS;
     }
 }
 
 void Session::ProcessSend(size_t bytesTransferred) {
     std::cout << "데이터 송신 완료: " << bytesTransferred << " bytes (소켓: " << socket_ << ")" << std::endl;
+
+    // 송신 중에 쌓인 메시지를 이어서 전송
+    bool closeNow = false;
+    {
+        std::lock_guard<std::mutex> lock(sendLock_);
+        isSending_ = false;
+        inflightBytes_ = 0;
+        if (isClosed_) return;
+
+        // 같은 배치에서 이 세션에 더 보낼 메시지가 생길 수 있으므로 배치 끝으로 미룸
+        if (queuedBytes_ > 0 && !flushDeferred_ && NetworkManager::DeferSendFlush(this)) {
+            flushDeferred_ = true;
+        } else if (!flushDeferred_ && !FlushSendQueue()) {
+            std::cerr << "대기 중인 송신 요청 실패 (소켓: " << socket_ << ")" << std::endl;
+        }
+        UpdateLagging(queuedBytes_ + inflightBytes_);
+        closeNow = closeAfterSend_ && !isSending_ && !flushDeferred_ && queuedBytes_ == 0;
+    }
+
+    // 마지막 안내까지 보냈으면 닫음 (Close는 sendLock_을 다시 잡으므로 락 밖에서)
+    if (closeNow) {
+        Close();
+    }
+}
+
+void Session::FlushDeferredSend() {
+    std::lock_guard<std::mutex> lock(sendLock_);
+    flushDeferred_ = false;
+    if (isClosed_ || isSending_) return;
+
+    if (!FlushSendQueue()) {
+        std::cerr << "대기 중인 송신 요청 실패 (소켓: " << socket_ << ")" << std::endl;
+    }
 }
 
 // 전역 매니저들을 서버를 통해 접근
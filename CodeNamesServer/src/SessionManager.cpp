@@ -1,5 +1,6 @@
 #include "SessionManager.h"
 #include "PacketProtocol.h"
+#include "PacketOpcode.h"
 #include "Session.h"
 #include "DatabaseManager.h"
 #include "GameManager.h"
@@ -10,7 +11,14 @@
 #include <ctime>
 #include "IOCPServer.h"
 
-SessionManager::SessionManager(IMediator* server) : server_(server), sessionCount_(0) {
+namespace {
+    // 닉네임은 CHAT / GAME_INIT 등에서 중간 필드로 실리므로 구분 문자가 들어가면 받는 쪽 필드가 어긋남 (텍스트 / 바이너리 모두)
+    bool IsValidNickname(std::string_view nickname) {
+        return nickname.find_first_of("|\r\n") == std::string_view::npos;
+    }
+}
+
+SessionManager::SessionManager(IMediator* server) : server_(server), sessionCount_(0), draining_(false) {
     if (!server_) {
         throw std::runtime_error("SessionManager: IMediator pointer cannot be null");
     }
@@ -24,64 +32,58 @@ bool SessionManager::AddSession(std::shared_ptr<Session> session) {
     if (!session) return false;
 
     std::lock_guard<std::mutex> lock(sessionMutex_);
-    SOCKET socket = session->GetSocket();
-    if (sessions_.count(socket) > 0) {
-        std::cerr << "AddSession 실패: 중복 소켓 " << socket << std::endl;
-        return false; // 중복 소켓
+    const std::string& token = session->GetToken();
+    if (!token.empty() && tokenToHandle_.count(token) > 0) {
+        std::cerr << "AddSession 실패: 중복 토큰 " << token << std::endl;
+        return false; // 중복 토큰
     }
 
-    sessions_[socket] = session;
-    const std::string& token = session->GetToken();
+    // 슬롯에 넣고 핸들 발급 (이후 I/O 완료와 게임방은 이 핸들로 세션을 찾음)
+    SessionHandle handle = sessions_.Insert(session);
+    if (!handle.IsValid()) {
+        std::cerr << "AddSession 실패: 슬롯 부족 (소켓 " << session->GetSocket() << ")" << std::endl;
+        return false;
+    }
+    session->SetHandle(handle);
+
     if (!token.empty()) {
-        if (tokenToSocket_.count(token) > 0) {
-            std::cerr << "AddSession 실패: 중복 토큰 " << token << std::endl;
-            sessions_.erase(socket); // 롤백
-            return false; // 중복 토큰
-        }
-        tokenToSocket_[token] = socket;
+        tokenToHandle_[token] = handle;
     }
 
     ++sessionCount_;
-    std::cout << "Session added: " << socket << " (Total: " << sessionCount_ << ")" << std::endl;
+    std::cout << "Session added: " << session->GetSocket() << " (Total: " << sessionCount_ << ")" << std::endl;
     return true;
 }
 
-void SessionManager::RemoveSession(SOCKET socket) {
-    if (socket == INVALID_SOCKET) return;
+void SessionManager::RemoveSession(SessionHandle handle) {
+    if (!handle.IsValid()) return;
 
     std::lock_guard<std::mutex> lock(sessionMutex_);
-    auto target = sessions_.find(socket);
+    auto session = sessions_.Lock(handle);
 
-    if (target != sessions_.end()) {
-        const std::string& token = target->second->GetToken();
-        if (!token.empty()) {
-            tokenToSocket_.erase(token);
+    if (session) {
+        const std::string& token = session->GetToken();
+        auto target = tokenToHandle_.find(token);
+        if (target != tokenToHandle_.end() && target->second == handle) {
+            tokenToHandle_.erase(target);
         }
-        sessions_.erase(target);
+        sessions_.Remove(handle);
         --sessionCount_;
 
-        std::cout << "Session removed: " << socket << " (Total: " << sessionCount_ << ")" << std::endl;
+        std::cout << "Session removed: " << session->GetSocket() << " (Total: " << sessionCount_ << ")" << std::endl;
     }
 }
 
-std::shared_ptr<Session> SessionManager::FindSession(SOCKET socket) {
-    std::lock_guard<std::mutex> lock(sessionMutex_);
-
-    auto target = sessions_.find(socket);
-    if (target != sessions_.end()) {
-        return target->second;
-    }
-
-    return nullptr;
+std::shared_ptr<Session> SessionManager::FindSession(SessionHandle handle) {
+    return sessions_.Lock(handle);
 }
 
 std::shared_ptr<Session> SessionManager::FindSessionByToken(const std::string& token) {
     std::lock_guard<std::mutex> lock(sessionMutex_);
 
-    auto target = tokenToSocket_.find(token);
-    if (target != tokenToSocket_.end()) {
-        SOCKET socket = target->second;
-        return FindSession(socket);
+    auto target = tokenToHandle_.find(token);
+    if (target != tokenToHandle_.end()) {
+        return sessions_.Lock(target->second);
     }
     
     return nullptr;
@@ -89,24 +91,24 @@ std::shared_ptr<Session> SessionManager::FindSessionByToken(const std::string& t
 
 bool SessionManager::ValidateToken(const std::string& token) {
     std::lock_guard<std::mutex> lock(sessionMutex_);
-    return tokenToSocket_.count(token) == 0; // 중복 없음
+    return tokenToHandle_.count(token) == 0; // 중복 없음
 }
 
 bool SessionManager::AddToMatchingQueue(std::shared_ptr<Session> session) {
     if (!session) return false;
 
     std::lock_guard<std::mutex> lock(sessionMutex_);
-    SOCKET socket = session->GetSocket();
+    SessionHandle handle = session->GetHandle();
 
     // 세션 존재 확인
-    if (sessions_.count(socket) == 0) {
-        std::cerr << "Session not found for matching queue: " << socket << std::endl;
+    if (!sessions_.Lock(handle)) {
+        std::cerr << "Session not found for matching queue: " << session->GetSocket() << std::endl;
         return false;
     }
 
-    matchingQueue_.push(socket);
+    matchingQueue_.push(handle);
     session->SetInMatchingQueue(true);
-    std::cout << "Session added to matching queue: " << socket << std::endl;
+    std::cout << "Session added to matching queue: " << session->GetSocket() << std::endl;
     return true;
 }
 
@@ -129,21 +131,41 @@ void SessionManager::RequestGameRoomCreation(const std::vector<std::shared_ptr<S
     server_->CreateGameRoom(players);
 }
 
+void SessionManager::BeginDrain() {
+    {
+        std::lock_guard<std::mutex> lock(sessionMutex_);
+        draining_ = true;
+        std::queue<SessionHandle> empty;
+        matchingQueue_.swap(empty);
+    }
+
+    // 게임 중인 세션은 게임이 끝날 때까지 그대로 (IOCPServer::DrainThread)
+    size_t redirected = 0;
+    for (const auto& session : sessions_.Snapshot()) {
+        if (!session || session->IsClosed() || session->GetState() == SessionState::IN_GAME) continue;
+        session->SetInMatchingQueue(false);
+        session->CloseAfterSend(PKT_SERVER_BUSY);
+        ++redirected;
+    }
+    std::cout << "Drain: 매칭 중단, 로비/대기 세션 " << redirected << "개에 재접속 안내" << std::endl;
+}
+
 std::vector<std::shared_ptr<Session>> SessionManager::GetWaitingPlayers() {
     std::vector<std::shared_ptr<Session>> waitingPlayers;
     
     std::lock_guard<std::mutex> lock(sessionMutex_);
     // 매칭 큐에서 유효한 세션들만 수집
-    std::queue<SOCKET> cleanQueue;
+    std::queue<SessionHandle> cleanQueue;
     // 지연 처리 방식으로 효율적이라고 한다.
     while (!matchingQueue_.empty()) {
-        SOCKET socket = matchingQueue_.front();
+        SessionHandle handle = matchingQueue_.front();
         matchingQueue_.pop();
 
-        auto sessionIt = sessions_.find(socket);
-        if (sessionIt != sessions_.end() && sessionIt->second->IsInMatchingQueue()) {
-            waitingPlayers.push_back(sessionIt->second);
-            cleanQueue.push(socket); // 유효한 세션만 다시 큐에 추가
+        // 연결이 끊긴 세션은 핸들 조회가 실패 (소켓 번호가 재사용되어도 섞이지 않음)
+        auto session = sessions_.Lock(handle);
+        if (session && session->IsInMatchingQueue()) {
+            waitingPlayers.push_back(session);
+            cleanQueue.push(handle); // 유효한 세션만 다시 큐에 추가
         }
         // 무효한 세션은 큐에서 제거
     }
@@ -158,20 +180,14 @@ void SessionManager::BroadcastToAll(const std::string& message) {
     if (message.empty()) return;
 
     // 락을 최소화 하기 위해 세션 목록 복사
-    std::vector<std::shared_ptr<Session>> sessionList;
-    {
-        std::lock_guard<std::mutex> lock(sessionMutex_);
-        sessionList.reserve(sessions_.size());
-
-        for (const auto& pair : sessions_) {
-            sessionList.push_back(pair.second);
-        }
-    }
+    std::vector<std::shared_ptr<Session>> sessionList = sessions_.Snapshot();
 
-    // 락 해제 후 브로드캐스트
+    // 락 해제 후 브로드캐스트 (프레임 1개를 모든 세션이 공유)
+    SharedPayload payload = Session::MakePayload(message);
+    SendPriority priority = Session::ClassifyOutbound(message);
     for (const auto& session : sessionList) {
         if (session && !session->IsClosed()) {
-            session->PostSend(message);
+            session->PostSend(payload, priority);
         }
     }
 
@@ -187,16 +203,11 @@ void SessionManager::DisconnectAll() {
     
     {
         std::lock_guard<std::mutex> lock(sessionMutex_);
-        sessionList.reserve(sessions_.size());
-        
-        for (const auto& pair : sessions_) {
-            sessionList.push_back(pair.second);
-        }
-        
-        // 컨테이너 정리
-        sessions_.clear();
-        tokenToSocket_.clear();
-        std::queue<SOCKET> empty;
+
+        // 컨테이너 정리 (슬롯에서 꺼낸 세션은 아래에서 종료)
+        sessionList = sessions_.Clear();
+        tokenToHandle_.clear();
+        std::queue<SessionHandle> empty;
         matchingQueue_.swap(empty);
         sessionCount_ = 0;
     }
@@ -213,189 +224,224 @@ void SessionManager::DisconnectAll() {
 
 // 게임 룸 제거는 IOCPServer에서 처리
 
-// 로비/매칭 패킷 처리
-void SessionManager::HandleLobbyPacket(Session* session, const std::string& data) {
+// 로비/매칭 패킷 처리 - opcode로 핸들러 표에서 바로 찾음 (이름을 차례로 비교하지 않음)
+void SessionManager::HandleLobbyPacket(Session* session, std::string_view data) {
     std::cout << "[SessionManager] 로비 패킷 처리: " << data << std::endl;
-    
-    if (data.find(std::string(PKT_CMD_QUERY_WAIT) + "|") == 0) // CMD|QUERY_WAIT|{token} - 매칭 대기 요청
-    {
-        std::string token = data.substr(std::string(PKT_CMD_QUERY_WAIT).size() + 1);
-
-        if (token == session->GetToken()) 
-        { // 매칭 큐에 추가
-            if (AddToMatchingQueue(session->shared_from_this())) {
-                // 현재 대기 인원 확인
-                auto waitingPlayers = GetWaitingPlayers();
-
-                if (waitingPlayers.size() == GameManager::MAX_PLAYERS) {
-                    // 게임 생성 처리
-                    std::thread gameThread(&SessionManager::RequestGameRoomCreation, this, waitingPlayers);
-                    gameThread.detach();  // 스레드를 detach하여 독립적으로 실행
-
-                    for (auto& player : waitingPlayers) {
-                        player->PostSend(PKT_QUEUE_FULL);
-                    }
-                } else {
-                    std::string waitMsg = std::string(PKT_WAIT_REPLY) + "|" + std::to_string(waitingPlayers.size()) + "|" + std::to_string(GameManager::MAX_PLAYERS);
-                
-                    // 대기자에게 현재 상황 전송
-                    for (auto& player : waitingPlayers) {
-                        player->PostSend(waitMsg);
-                    }
-                }
-            } else {
-                session->PostSend(PKT_QUEUE_ERROR);
-            }
-        } else {
-            session->PostSend(PKT_INVALID_TOKEN);
-        }
-    } else if (data.find(std::string(PKT_SESSION_READY) + "|") == 0) {
-        std::string token = data.substr(std::string(PKT_SESSION_READY).size() + 1);
 
-        if(token == session->GetToken()) {
-            session->PostSend(PKT_SESSION_ACK);
-        } else {
-            session->PostSend(PKT_SESSION_NOT_FOUND);
+    static constexpr auto handlers = PacketOpcode::MakeTable<PacketHandler>({
+        { Opcode::CMD_QUERY_WAIT,  &SessionManager::HandleQueryWait },
+        { Opcode::SESSION_READY,   &SessionManager::HandleSessionReady },
+        { Opcode::MATCHING_CANCEL, &SessionManager::HandleMatchingCancel },
+    });
+
+    std::string_view fields;
+    PacketHandler handler = handlers[static_cast<size_t>(PacketOpcode::LookupCommand(data, fields))];
+    if (!handler) {
+        std::cerr << "Unknown lobby packet: " << data << std::endl;
+        session->PostSend(PKT_LOBBY_ERROR_UNKNOWN);
+        return;
+    }
+    (this->*handler)(session, Packet::Fields(fields));
+}
+
+// CMD|QUERY_WAIT|{token} - 매칭 대기 요청
+void SessionManager::HandleQueryWait(Session* session, const Packet::Fields& fields) {
+    if (fields[0] != session->GetToken()) {
+        session->PostSend(PKT_INVALID_TOKEN);
+        return;
+    }
+
+    // 드레인 중에는 새 게임을 만들지 않으므로 새 프로세스로 재접속하도록 안내
+    if (draining_) {
+        session->CloseAfterSend(PKT_SERVER_BUSY);
+        return;
+    }
+
+    // 매칭 큐에 추가
+    if (!AddToMatchingQueue(session->shared_from_this())) {
+        session->PostSend(PKT_QUEUE_ERROR);
+        return;
+    }
+
+    // 현재 대기 인원 확인
+    auto waitingPlayers = GetWaitingPlayers();
+
+    if (waitingPlayers.size() == GameManager::MAX_PLAYERS) {
+        // 게임 생성 처리
+        std::thread gameThread(&SessionManager::RequestGameRoomCreation, this, waitingPlayers);
+        gameThread.detach();  // 스레드를 detach하여 독립적으로 실행
+
+        for (auto& player : waitingPlayers) {
+            player->PostSend(PKT_QUEUE_FULL);
         }
-    } else if (data.find(std::string(PKT_MATCHING_CANCEL) + "|") == 0) {
-        // MATCHING_CANCEL|{token} - 매칭 취소
-        std::string token = data.substr(std::string(PKT_MATCHING_CANCEL).size() + 1);
-        if (token == session->GetToken()) {
-            RemoveFromMatchingQueue(session->shared_from_this());
-            session->PostSend(PKT_CANCEL_OK);
-        } else {
-            session->PostSend(PKT_CANCEL_OK);
+    } else {
+        std::string waitMsg = std::string(PKT_WAIT_REPLY) + "|" + std::to_string(waitingPlayers.size()) + "|" + std::to_string(GameManager::MAX_PLAYERS);
+
+        // 대기자에게 현재 상황 전송
+        for (auto& player : waitingPlayers) {
+            player->PostSend(waitMsg);
         }
     }
-    else {
-        std::cerr << "Unknown lobby packet: " << data << std::endl;
-        session->PostSend(PKT_LOBBY_ERROR_UNKNOWN);
+}
+
+// SESSION_READY|{token}
+void SessionManager::HandleSessionReady(Session* session, const Packet::Fields& fields) {
+    if (fields[0] == session->GetToken()) {
+        session->PostSend(PKT_SESSION_ACK);
+    } else {
+        session->PostSend(PKT_SESSION_NOT_FOUND);
     }
 }
 
+// MATCHING_CANCEL|{token} - 매칭 취소
+void SessionManager::HandleMatchingCancel(Session* session, const Packet::Fields& fields) {
+    if (fields[0] == session->GetToken()) {
+        RemoveFromMatchingQueue(session->shared_from_this());
+    }
+    session->PostSend(PKT_CANCEL_OK);
+}
+
 // 인증 관련 프로토콜 처리 (CHECK_ID, SIGNUP, LOGIN, TOKEN, EDIT_NICK)
-void SessionManager::HandleAuthProtocol(Session* session, const std::string& data) {
+// 필드는 data를 가리키는 조각이고, DB에 넘기거나 세션에 저장하는 값만 std::string으로 복사
+void SessionManager::HandleAuthProtocol(Session* session, std::string_view data) {
     std::cout << "[SessionManager] 인증 패킷 처리: " << data << std::endl;
-    
-    if(data.find(std::string(PKT_CHECK_ID) + "|") == 0) 
-    {
-        // CHECK_ID|{id} - ID 중복 검사
-        std::string id = data.substr(std::string(PKT_CHECK_ID).size() + 1);
-
-        if (auto dbManager = session->GetDatabaseManager()) {
-            if (dbManager->CheckIdExists(id)) {
-                session->PostSend(PKT_CHECK_ID_DUPLICATE);
-            } else {
-                session->PostSend(PKT_CHECK_ID_OK);
-            }
-        } else {
-            session->PostSend(PKT_CHECK_ID_ERROR);
-        }
-        
-    } else if (data.find(std::string(PKT_SIGNUP) + "|") == 0)
-    {
-        // SIOGNUP|{id}|{password}|{nickname} - 회원가입
-        size_t first_pipe = data.find('|', 7);
-        size_t second_pipe = data.find('|', first_pipe + 1);
-
-        if (first_pipe != std::string::npos && second_pipe != std::string::npos)
-        {
-            std::string id = data.substr(7, first_pipe - 7);
-            std::string pw = data.substr(first_pipe + 1, second_pipe - first_pipe - 1);
-            std::string nick = data.substr(second_pipe + 1);
-
-            if (auto dbManager = session->GetDatabaseManager()) {
-                // Measure Signup latency for diagnostics
-                auto t0 = std::chrono::steady_clock::now();
-                DatabaseResult result = dbManager->SignupUser(id, pw, nick);
-                auto t1 = std::chrono::steady_clock::now();
-                auto ms = std::chrono::duration_cast<std::chrono::milliseconds>(t1 - t0).count();
-                std::cout << "[Timing] SignupUser took " << ms << " ms for id=" << id << std::endl;
-                if (result == DatabaseResult::SUCCESS) {
-                    std::string token = dbManager->GenerateToken();
-                    session->SetToken(token);
-                    session->SetNickname(nick);
-                    session->PostSend(std::string(PKT_SIGNUP_OK) + "|" + token);
-                } else if (result == DatabaseResult::NICK_DUPLICATE) {
-                    session->PostSend(PKT_SIGNUP_DUPLICATE);
-                } else {
-                    session->PostSend(PKT_SIGNUP_ERROR);
-                }
-            } else {
-                session->PostSend(PKT_SIGNUP_ERROR);
-            }
+
+    static constexpr auto handlers = PacketOpcode::MakeTable<PacketHandler>({
+        { Opcode::CHECK_ID,  &SessionManager::HandleCheckId },
+        { Opcode::SIGNUP,    &SessionManager::HandleSignup },
+        { Opcode::LOGIN,     &SessionManager::HandleLogin },
+        { Opcode::TOKEN,     &SessionManager::HandleToken },
+        { Opcode::EDIT_NICK, &SessionManager::HandleEditNick },
+    });
+
+    std::string_view fields;
+    PacketHandler handler = handlers[static_cast<size_t>(PacketOpcode::LookupCommand(data, fields))];
+    if (!handler) {
+        std::cerr << "Unknown auth packet: " << data << std::endl;
+        session->PostSend(PKT_AUTH_ERROR_UNKNOWN);
+        return;
+    }
+    (this->*handler)(session, Packet::Fields(fields));
+}
+
+// CHECK_ID|{id} - ID 중복 검사
+void SessionManager::HandleCheckId(Session* session, const Packet::Fields& fields) {
+    if (auto dbManager = session->GetDatabaseManager()) {
+        if (dbManager->CheckIdExists(std::string(fields[0]))) {
+            session->PostSend(PKT_CHECK_ID_DUPLICATE);
         } else {
-            session->PostSend(PKT_SIGNUP_ERROR);
+            session->PostSend(PKT_CHECK_ID_OK);
         }
-    } else if (data.find(std::string(PKT_LOGIN) + "|") == 0) {
-        // LOGIN|{id}|{pw} - 로그인
-        size_t pipe_pos = data.find('|', std::string(PKT_LOGIN).size() + 1);
-
-        if (pipe_pos != std::string::npos) {
-            std::string id = data.substr(std::string(PKT_LOGIN).size() + 1, pipe_pos - (std::string(PKT_LOGIN).size() + 1));
-            std::string pw = data.substr(pipe_pos + 1);
-            if (auto dbManager = session->GetDatabaseManager()) {
-                DatabaseResult result = dbManager->LoginUser(id, pw);
-                if (result == DatabaseResult::SUCCESS) {
-                    // 사용자 정보 로드
-                    auto userInfo = dbManager->GetUserInfoByToken(id);
-                    if (userInfo) {
-                        session->SetUserInfo(*userInfo);  // Session에 사용자 정보 저장
-                        session->SetLoggedIn(true);
-                        
-                        std::string token = dbManager->GenerateToken();
-                        session->SetToken(token);
-                        session->SetNickname(userInfo->nickname);
-                        session->PostSend(std::string(PKT_LOGIN_OK) + "|" + token);
-                        session->SetState(SessionState::IN_LOBBY);
-                    } else {
-                        session->PostSend(PKT_LOGIN_ERROR);
-                    }
-                } else if (result == DatabaseResult::NOT_FOUND) {
-                    session->PostSend(PKT_LOGIN_NO_ACCOUNT);
-                } else if (result == DatabaseResult::WRONG_PASSWORD) {
-                    session->PostSend(PKT_LOGIN_WRONG_PW);
-                } else if (result == DatabaseResult::SUSPENDED) {
-                    session->PostSend(PKT_LOGIN_SUSPENDED);
-                } else {
-                    session->PostSend(PKT_LOGIN_ERROR);
-                }
-            } else {
-                session->PostSend(PKT_LOGIN_ERROR);
-            }
-        } else {
-            session->PostSend(PKT_LOGIN_ERROR);
-        } 
-    } else if (data.find(std::string(PKT_TOKEN) + "|") == 0) 
-    {
-        std::string token = data.substr(std::string(PKT_TOKEN).size() + 1);
+    } else {
+        session->PostSend(PKT_CHECK_ID_ERROR);
+    }
+}
+
+// SIGNUP|{id}|{password}|{nickname} - 회원가입
+void SessionManager::HandleSignup(Session* session, const Packet::Fields& fields) {
+    if (fields.Count() < 3) {
+        session->PostSend(PKT_SIGNUP_ERROR);
+        return;
+    }
+
+    std::string id(fields[0]);
+    std::string pw(fields[1]);
+    std::string nick(fields.Rest(2));
+    if (!IsValidNickname(nick)) {
+        session->PostSend(PKT_SIGNUP_ERROR);
+        return;
+    }
+
+    auto dbManager = session->GetDatabaseManager();
+    if (!dbManager) {
+        session->PostSend(PKT_SIGNUP_ERROR);
+        return;
+    }
+
+    // Measure Signup latency for diagnostics
+    auto t0 = std::chrono::steady_clock::now();
+    DatabaseResult result = dbManager->SignupUser(id, pw, nick);
+    auto t1 = std::chrono::steady_clock::now();
+    auto ms = std::chrono::duration_cast<std::chrono::milliseconds>(t1 - t0).count();
+    std::cout << "[Timing] SignupUser took " << ms << " ms for id=" << id << std::endl;
+    if (result == DatabaseResult::SUCCESS) {
+        std::string token = dbManager->GenerateToken();
+        session->SetToken(token);
+        session->SetNickname(nick);
+        session->PostSend(std::string(PKT_SIGNUP_OK) + "|" + token);
+    } else if (result == DatabaseResult::NICK_DUPLICATE) {
+        session->PostSend(PKT_SIGNUP_DUPLICATE);
+    } else {
+        session->PostSend(PKT_SIGNUP_ERROR);
+    }
+}
 
-        if (token == session->GetToken()) {
-            session->PostSend(std::string(PKT_TOKEN_VALID) + "|" + session->GetNickname());
+// LOGIN|{id}|{pw} - 로그인
+void SessionManager::HandleLogin(Session* session, const Packet::Fields& fields) {
+    if (fields.Count() < 2) {
+        session->PostSend(PKT_LOGIN_ERROR);
+        return;
+    }
+
+    std::string id(fields[0]);
+    std::string pw(fields.Rest(1));
+    auto dbManager = session->GetDatabaseManager();
+    if (!dbManager) {
+        session->PostSend(PKT_LOGIN_ERROR);
+        return;
+    }
+
+    DatabaseResult result = dbManager->LoginUser(id, pw);
+    if (result == DatabaseResult::SUCCESS) {
+        // 사용자 정보 로드
+        auto userInfo = dbManager->GetUserInfoByToken(id);
+        if (userInfo) {
+            session->SetUserInfo(*userInfo);  // Session에 사용자 정보 저장
+            session->SetLoggedIn(true);
+
+            std::string token = dbManager->GenerateToken();
+            session->SetToken(token);
+            session->SetNickname(userInfo->nickname);
+            session->PostSend(std::string(PKT_LOGIN_OK) + "|" + token);
+            session->SetState(SessionState::IN_LOBBY);
         } else {
-            session->PostSend(PKT_INVALID_TOKEN);
+            session->PostSend(PKT_LOGIN_ERROR);
         }
-    } else if (data.find(std::string(PKT_EDIT_NICK) + "|") == 0)
-    {
-        // EDIT_NICK|{token}|{new_nick} - 닉네임 수정
-        size_t pipe_pos = data.find('|', std::string(PKT_EDIT_NICK).size() + 1);
-        
-        if (pipe_pos != std::string::npos) {
-            std::string token = data.substr(std::string(PKT_EDIT_NICK).size() + 1, pipe_pos - (std::string(PKT_EDIT_NICK).size() + 1));
-            std::string new_nick = data.substr(pipe_pos + 1);
-            
-            if (token == session->GetToken()) {
-                session->SetNickname(new_nick);
-                session->PostSend(PKT_NICKNAME_EDIT_OK);
-            } else {
-                session->PostSend(PKT_INVALID_TOKEN);
-            }
-        } else {
+    } else if (result == DatabaseResult::NOT_FOUND) {
+        session->PostSend(PKT_LOGIN_NO_ACCOUNT);
+    } else if (result == DatabaseResult::WRONG_PASSWORD) {
+        session->PostSend(PKT_LOGIN_WRONG_PW);
+    } else if (result == DatabaseResult::SUSPENDED) {
+        session->PostSend(PKT_LOGIN_SUSPENDED);
+    } else {
+        session->PostSend(PKT_LOGIN_ERROR);
+    }
+}
+
+// TOKEN|{token}
+void SessionManager::HandleToken(Session* session, const Packet::Fields& fields) {
+    if (fields[0] == session->GetToken()) {
+        session->PostSend(std::string(PKT_TOKEN_VALID) + "|" + session->GetNickname());
+    } else {
+        session->PostSend(PKT_INVALID_TOKEN);
+    }
+}
+
+// EDIT_NICK|{token}|{new_nick} - 닉네임 수정
+void SessionManager::HandleEditNick(Session* session, const Packet::Fields& fields) {
+    if (fields.Count() < 2) {
+        session->PostSend(PKT_NICKNAME_EDIT_ERROR);
+        return;
+    }
+
+    if (fields[0] == session->GetToken()) {
+        if (!IsValidNickname(fields.Rest(1))) {
             session->PostSend(PKT_NICKNAME_EDIT_ERROR);
+            return;
         }
-    } else 
-    {
-        std::cerr << "Unknown auth packet: " << data << std::endl;
-        session->PostSend(PKT_AUTH_ERROR_UNKNOWN);
+        session->SetNickname(std::string(fields.Rest(1)));
+        session->PostSend(PKT_NICKNAME_EDIT_OK);
+    } else {
+        session->PostSend(PKT_INVALID_TOKEN);
     }
 }
\ No newline at end of file
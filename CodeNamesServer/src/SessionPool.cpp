@@ -0,0 +1,175 @@
+#include "SessionPool.h"
+#include "Session.h"
+
+#include <atomic>
+#include <cstddef>
+#include <iostream>
+#include <mutex>
+#include <new>
+#include <vector>
+
+struct SessionPool::State {
+    std::mutex mutex;
+    std::vector<Session*> freeSessions; // 반납된 (닫힌) 세션
+    std::vector<void*> freeBlocks;      // 비어 있는 제어 블록
+    std::unique_ptr<unsigned char[]> blocks;
+    size_t blockCount = 0;
+    size_t capacity = 0;
+    size_t inUse = 0;
+    bool closed = false; // 풀이 사라진 뒤 반납되는 세션은 그대로 해제
+
+    std::atomic<size_t> inUseStat{ 0 };
+    std::atomic<size_t> highWater{ 0 };
+    std::atomic<uint64_t> overflow{ 0 };
+
+    bool OwnsBlock(const void* pointer) const {
+        auto* byte = static_cast<const unsigned char*>(pointer);
+        return blocks && byte >= blocks.get() && byte < blocks.get() + blockCount * CONTROL_BLOCK_SIZE;
+    }
+};
+
+// shared_ptr 제어 블록 할당자 - 미리 잡아둔 블록을 쓰고, 모자라거나 크기가 맞지 않으면 일반 할당
+// (제어 블록은 세션의 weak_from_this가 다음 재사용 때까지 잡고 있으므로 세션 수보다 조금 넉넉히 둠)
+template<typename T>
+struct SessionPool::BlockAllocator {
+    using value_type = T;
+    std::shared_ptr<State> state; // 마지막 제어 블록이 반납될 때까지 State 유지
+
+    explicit BlockAllocator(std::shared_ptr<State> poolState) : state(std::move(poolState)) {}
+    template<typename U>
+    BlockAllocator(const BlockAllocator<U>& other) : state(other.state) {}
+
+    T* allocate(size_t count) {
+        if (count == 1 && sizeof(T) <= CONTROL_BLOCK_SIZE && alignof(T) <= alignof(std::max_align_t)) {
+            std::lock_guard<std::mutex> lock(state->mutex);
+            if (!state->freeBlocks.empty()) {
+                void* block = state->freeBlocks.back();
+                state->freeBlocks.pop_back();
+                return static_cast<T*>(block);
+            }
+        }
+        return static_cast<T*>(::operator new(count * sizeof(T)));
+    }
+
+    void deallocate(T* pointer, size_t) {
+        if (state->OwnsBlock(pointer)) {
+            std::lock_guard<std::mutex> lock(state->mutex);
+            state->freeBlocks.push_back(pointer);
+            return;
+        }
+        ::operator delete(pointer);
+    }
+
+    template<typename U>
+    bool operator==(const BlockAllocator<U>& other) const { return state == other.state; }
+    template<typename U>
+    bool operator!=(const BlockAllocator<U>& other) const { return state != other.state; }
+};
+
+// 마지막 shared_ptr이 사라질 때 세션을 해제하지 않고 닫은 뒤 풀로 반납
+struct SessionPool::Recycler {
+    std::shared_ptr<State> state;
+
+    void operator()(Session* session) const {
+        session->Close(); // 아직 열려 있으면 소켓 / 백엔드 정리 (기존 소멸자와 동일)
+
+        std::unique_lock<std::mutex> lock(state->mutex);
+        --state->inUse;
+        state->inUseStat.store(state->inUse, std::memory_order_relaxed);
+        if (state->closed) {
+            lock.unlock();
+            delete session;
+            return;
+        }
+        state->freeSessions.push_back(session); // capacity만큼 예약해 두어 할당 없음
+    }
+};
+
+SessionPool::SessionPool(NetworkManager* networkManager)
+    : networkManager_(networkManager) {
+}
+
+SessionPool::~SessionPool() {
+    if (!state_) return;
+
+    std::vector<Session*> idle;
+    {
+        std::lock_guard<std::mutex> lock(state_->mutex);
+        state_->closed = true;
+        idle.swap(state_->freeSessions);
+    }
+
+    // 세션이 해제되면서 잡고 있던 제어 블록도 반납됨 (나가 있는 세션은 반납 시 해제)
+    for (Session* session : idle) {
+        delete session;
+    }
+}
+
+bool SessionPool::Initialize(size_t capacity) {
+    if (capacity == 0) {
+        std::cout << "Session pool disabled (세션마다 새로 할당)" << std::endl;
+        return true;
+    }
+
+    auto state = std::make_shared<State>();
+    state->capacity = capacity;
+    state->blockCount = capacity + CONTROL_BLOCK_SLACK;
+    state->blocks.reset(new unsigned char[state->blockCount * CONTROL_BLOCK_SIZE]);
+    state->freeBlocks.reserve(state->blockCount);
+    for (size_t i = 0; i < state->blockCount; ++i) {
+        state->freeBlocks.push_back(state->blocks.get() + i * CONTROL_BLOCK_SIZE);
+    }
+
+    // 미리 만든 세션은 닫힌 상태로 대기 (Acquire에서 Reuse로 열림)
+    state->freeSessions.reserve(capacity);
+    for (size_t i = 0; i < capacity; ++i) {
+        state->freeSessions.push_back(new Session(INVALID_SOCKET, networkManager_));
+    }
+
+    state_ = std::move(state);
+    std::cout << "Session pool: " << capacity << " sessions preallocated" << std::endl;
+    return true;
+}
+
+std::shared_ptr<Session> SessionPool::Acquire(SOCKET socket) {
+    Session* session = nullptr;
+    if (state_) {
+        std::lock_guard<std::mutex> lock(state_->mutex);
+        if (!state_->freeSessions.empty()) {
+            session = state_->freeSessions.back();
+            state_->freeSessions.pop_back();
+
+            ++state_->inUse;
+            state_->inUseStat.store(state_->inUse, std::memory_order_relaxed);
+            if (state_->inUse > state_->highWater.load(std::memory_order_relaxed)) {
+                state_->highWater.store(state_->inUse, std::memory_order_relaxed);
+            }
+        }
+    }
+
+    if (!session) {
+        if (state_) {
+            state_->overflow.fetch_add(1, std::memory_order_relaxed);
+        }
+        return std::make_shared<Session>(socket, networkManager_);
+    }
+
+    session->Reuse(socket);
+    return std::shared_ptr<Session>(session, Recycler{ state_ }, BlockAllocator<Session>(state_));
+}
+
+size_t SessionPool::GetCapacity() const {
+    return state_ ? state_->capacity : 0;
+}
+
+size_t SessionPool::GetInUse() const {
+    return state_ ? state_->inUseStat.load(std::memory_order_relaxed) : 0;
+}
+
+size_t SessionPool::GetHighWater() const {
+    return state_ ? state_->highWater.load(std::memory_order_relaxed) : 0;
+}
+
+uint64_t SessionPool::GetOverflowCount() const {
+    return state_ ? state_->overflow.load(std::memory_order_relaxed) : 0;
+}
@@ -0,0 +1,195 @@
+#include "SessionSlotMap.h"
+#include "Session.h"
+#include <algorithm>
+#include <iostream>
+
+SessionSlotMap::SessionSlotMap()
+    : slotCount_(0), size_(0), epoch_(1), readerLimit_(0), hasRetired_(false) {
+    for (auto& chunk : chunks_) {
+        chunk.store(nullptr, std::memory_order_relaxed);
+    }
+}
+
+SessionSlotMap::~SessionSlotMap() {
+    // 워커가 모두 멈춘 뒤이므로 유예 목록과 남은 세션을 그대로 해제
+    retired_.clear();
+    for (auto& chunk : chunks_) {
+        delete[] chunk.load(std::memory_order_relaxed);
+    }
+}
+
+SessionSlotMap::Slot* SessionSlotMap::FindSlot(uint32_t index) const {
+    if (index / CHUNK_SIZE >= MAX_CHUNKS) return nullptr;
+
+    Slot* chunk = chunks_[index / CHUNK_SIZE].load(std::memory_order_acquire);
+    return chunk ? &chunk[index % CHUNK_SIZE] : nullptr;
+}
+
+SessionHandle SessionSlotMap::Insert(std::shared_ptr<Session> session) {
+    if (!session) return {};
+
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    // 반납된 슬롯을 먼저 재사용하고, 없으면 다음 슬롯 (청크가 없으면 새로 할당)
+    uint32_t index;
+    if (!freeSlots_.empty()) {
+        index = freeSlots_.back();
+        freeSlots_.pop_back();
+    } else {
+        if (slotCount_ >= CHUNK_SIZE * MAX_CHUNKS) {
+            std::cerr << "SessionSlotMap: 슬롯 부족 (최대 " << CHUNK_SIZE * MAX_CHUNKS << ")" << std::endl;
+            return {};
+        }
+        index = slotCount_++;
+        if (index % CHUNK_SIZE == 0) {
+            chunks_[index / CHUNK_SIZE].store(new Slot[CHUNK_SIZE], std::memory_order_release);
+        }
+    }
+
+    Slot* slot = FindSlot(index);
+    slot->owner = std::move(session);
+    slot->session.store(slot->owner.get(), std::memory_order_release);
+    ++size_;
+
+    return { index, slot->generation.load(std::memory_order_relaxed) };
+}
+
+bool SessionSlotMap::Remove(SessionHandle handle) {
+    Retired retired;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        Slot* slot = FindSlot(handle.index);
+        if (!slot || slot->generation.load(std::memory_order_relaxed) != handle.generation) {
+            return false; // 이미 제거됨
+        }
+
+        // 세대를 먼저 올려 이후의 Resolve가 실패하게 한 뒤 포인터를 비움 (0은 "세션 없음"이므로 건너뜀)
+        uint32_t next = handle.generation + 1;
+        slot->generation.store(next != 0 ? next : 1);
+        slot->session.store(nullptr);
+
+        retired.session = std::move(slot->owner);
+        freeSlots_.push_back(handle.index);
+        --size_;
+    }
+
+    // 지금까지 Resolve를 시작한 워커가 모두 지나갈 때까지 해제를 미룸
+    retired.epoch = epoch_.fetch_add(1);
+    {
+        std::lock_guard<std::mutex> lock(retiredMutex_);
+        retired_.push_back(std::move(retired));
+        hasRetired_ = true;
+    }
+
+    Reclaim();
+    return true;
+}
+
+Session* SessionSlotMap::Resolve(SessionHandle handle) const {
+    Slot* slot = FindSlot(handle.index);
+    if (!slot) return nullptr;
+
+    // 포인터를 읽는 사이에 슬롯이 재사용될 수 있으므로 세대를 앞뒤로 확인
+    if (slot->generation.load(std::memory_order_acquire) != handle.generation) return nullptr;
+    Session* session = slot->session.load(std::memory_order_acquire);
+    if (slot->generation.load(std::memory_order_acquire) != handle.generation) return nullptr;
+    return session;
+}
+
+std::shared_ptr<Session> SessionSlotMap::Lock(SessionHandle handle) const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    Slot* slot = FindSlot(handle.index);
+    if (!slot || slot->generation.load(std::memory_order_relaxed) != handle.generation) {
+        return nullptr;
+    }
+    return slot->owner;
+}
+
+std::vector<std::shared_ptr<Session>> SessionSlotMap::Snapshot() const {
+    std::vector<std::shared_ptr<Session>> sessions;
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    sessions.reserve(size_);
+    for (uint32_t i = 0; i < slotCount_; ++i) {
+        Slot* slot = FindSlot(i);
+        if (slot->owner) sessions.push_back(slot->owner);
+    }
+    return sessions;
+}
+
+std::vector<std::shared_ptr<Session>> SessionSlotMap::Clear() {
+    auto sessions = Snapshot();
+    for (const auto& session : sessions) {
+        Remove(session->GetHandle());
+    }
+    return sessions;
+}
+
+size_t SessionSlotMap::Size() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return size_;
+}
+
+int SessionSlotMap::RegisterReader() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (int i = 0; i < MAX_READERS; ++i) {
+        if (readers_[i].used) continue;
+
+        readers_[i].used = true;
+        readers_[i].epoch = epoch_.load();
+        if (i >= readerLimit_.load()) readerLimit_ = i + 1;
+        return i;
+    }
+
+    std::cerr << "SessionSlotMap: 워커 등록 실패 (최대 " << MAX_READERS << ")" << std::endl;
+    return -1;
+}
+
+void SessionSlotMap::UnregisterReader(int reader) {
+    if (reader < 0) return;
+
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        readers_[reader].epoch = READER_IDLE;
+        readers_[reader].used = false;
+    }
+    Reclaim();
+}
+
+void SessionSlotMap::ReaderBusy(int reader) {
+    if (reader < 0) return;
+    // 이 시점의 epoch 기록 - 이후 Remove된 세션은 이 워커를 기다리지 않아도 됨 (Resolve가 실패하므로)
+    readers_[reader].epoch.store(epoch_.load());
+}
+
+void SessionSlotMap::ReaderIdle(int reader) {
+    if (reader < 0) return;
+    readers_[reader].epoch.store(READER_IDLE);
+    Reclaim();
+}
+
+void SessionSlotMap::Reclaim() {
+    if (!hasRetired_.load(std::memory_order_acquire)) return;
+
+    std::deque<Retired> released;
+    {
+        // 다른 워커가 정리 중이면 그쪽에 맡김
+        std::unique_lock<std::mutex> lock(retiredMutex_, std::try_to_lock);
+        if (!lock.owns_lock()) return;
+
+        // 아직 완료를 처리 중인 워커 중 가장 오래된 epoch
+        uint64_t oldest = READER_IDLE;
+        int limit = readerLimit_.load();
+        for (int i = 0; i < limit; ++i) {
+            oldest = std::min<uint64_t>(oldest, readers_[i].epoch.load());
+        }
+
+        while (!retired_.empty() && retired_.front().epoch < oldest) {
+            released.push_back(std::move(retired_.front()));
+            retired_.pop_front();
+        }
+        hasRetired_ = !retired_.empty();
+    }
+
+    // 세션 소멸자는 락 밖에서 실행 (released가 사라지면서 해제)
+}
@@ -0,0 +1,64 @@
+#include "Shard.h"
+#include <algorithm>
+
+namespace {
+    thread_local int t_currentShard = -1;
+}
+
+Shard::Shard(int index, std::unique_ptr<IOBackend> backend)
+    : index_(index), backend_(std::move(backend)), hasPending_(false), probePostedMs_(0), latencyMs_(0) {
+}
+
+void Shard::Post(std::function<void()> task) {
+    bool wasEmpty;
+    {
+        std::lock_guard<std::mutex> lock(mailboxMutex_);
+        wasEmpty = mailbox_.empty();
+        mailbox_.push_back(std::move(task));
+        hasPending_.store(true, std::memory_order_release);
+    }
+
+    // 비어있던 메일박스에 처음 넣은 경우만 깨움 (워커가 RunPending에서 한꺼번에 처리)
+    if (wasEmpty && backend_) {
+        backend_->Wakeup();
+    }
+}
+
+void Shard::RunPending() {
+    std::vector<std::function<void()>> tasks;
+    {
+        std::lock_guard<std::mutex> lock(mailboxMutex_);
+        if (mailbox_.empty()) return;
+        tasks.swap(mailbox_);
+        hasPending_.store(false, std::memory_order_relaxed);
+    }
+
+    // 락 밖에서 실행 (작업 안에서 다시 Post해도 교착 없음)
+    for (auto& task : tasks) {
+        task();
+    }
+}
+
+void Shard::ProbeLatency(int64_t nowMs) {
+    int64_t expected = 0;
+    if (!probePostedMs_.compare_exchange_strong(expected, nowMs)) return; // 이전 측정이 아직 밀려 있음
+
+    Post([this, nowMs]() {
+        latencyMs_.store(TimingWheel::NowMs() - nowMs, std::memory_order_relaxed);
+        probePostedMs_.store(0, std::memory_order_release);
+    });
+}
+
+int64_t Shard::GetLatencyMs(int64_t nowMs) const {
+    int64_t latency = latencyMs_.load(std::memory_order_relaxed);
+    int64_t posted = probePostedMs_.load(std::memory_order_acquire);
+    return posted ? std::max<int64_t>(latency, nowMs - posted) : latency;
+}
+
+int Shard::CurrentIndex() {
+    return t_currentShard;
+}
+
+void Shard::SetCurrentIndex(int index) {
+    t_currentShard = index;
+}
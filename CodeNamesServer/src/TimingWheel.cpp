@@ -0,0 +1,45 @@
+#include "TimingWheel.h"
+#include <algorithm>
+
+TimingWheel::TimingWheel()
+    : slots_(SLOT_COUNT), currentTick_(NowMs() / TICK_MS), size_(0) {
+    nextTickMs_ = currentTick_ * TICK_MS;
+}
+
+void TimingWheel::Schedule(SessionHandle handle, int64_t delayMs) {
+    if (!handle.IsValid()) return;
+
+    // 올림 - 기한보다 일찍 확인하면 다시 넣어야 하므로 최소 1틱 뒤
+    int64_t ticks = (std::max<int64_t>(delayMs, 0) + TICK_MS - 1) / TICK_MS;
+    ticks = std::min<int64_t>(std::max<int64_t>(ticks, 1), SLOT_COUNT - 1);
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    slots_[static_cast<size_t>(currentTick_ + ticks) & (SLOT_COUNT - 1)].push_back(handle);
+    ++size_;
+}
+
+bool TimingWheel::Advance(int64_t nowMs, std::vector<SessionHandle>& expired) {
+    if (nowMs < nextTickMs_.load(std::memory_order_relaxed)) return false;
+
+    // 다른 워커가 이미 돌리는 중이면 맡김
+    std::unique_lock<std::mutex> lock(mutex_, std::try_to_lock);
+    if (!lock.owns_lock()) return false;
+
+    int64_t nowTick = nowMs / TICK_MS;
+    if (currentTick_ > nowTick) return false;
+
+    // 오래 멈춰 있었어도 한 바퀴 이상은 돌 필요 없음
+    int64_t steps = std::min<int64_t>(nowTick - currentTick_ + 1, SLOT_COUNT);
+    for (int64_t i = 0; i < steps; ++i) {
+        auto& slot = slots_[static_cast<size_t>(currentTick_ + i) & (SLOT_COUNT - 1)];
+        if (slot.empty()) continue;
+
+        expired.insert(expired.end(), slot.begin(), slot.end());
+        size_ -= slot.size();
+        slot.clear(); // 용량은 유지 (다음 바퀴에 재사용)
+    }
+
+    currentTick_ = nowTick + 1;
+    nextTickMs_ = currentTick_ * TICK_MS;
+    return !expired.empty();
+}
@@ -0,0 +1,20 @@
+#include "TokenBucket.h"
+#include <algorithm>
+
+bool TokenBucket::TryConsume(const RateLimit& limit, int64_t nowMs) {
+    if (limit.perSec == 0) return true;
+
+    int64_t capacity = static_cast<int64_t>(std::max<uint32_t>(limit.burst, 1)) * UNIT;
+    if (milliTokens_ < 0) {
+        milliTokens_ = capacity;
+        lastMs_ = nowMs;
+    } else if (nowMs > lastMs_) {
+        // 가득 찬 뒤의 시간은 버림 (오래 조용했던 세션도 burst 이상 몰아 보낼 수 없음)
+        milliTokens_ = std::min<int64_t>(capacity, milliTokens_ + (nowMs - lastMs_) * limit.perSec);
+        lastMs_ = nowMs;
+    }
+
+    if (milliTokens_ < UNIT) return false;
+    milliTokens_ -= UNIT;
+    return true;
+}
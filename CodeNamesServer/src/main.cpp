@@ -1,9 +1,216 @@
 #include <iostream>
-#define WIN32_LEAN_AND_MEAN
-#include <winsock2.h>
-#include <ws2tcpip.h>
-#include <Windows.h>
+#include "Platform.h"
 #include "IOCPServer.h"
+#include "Session.h"
+#include <cstring>
+#include <cstdlib>
+#include <string>
+#include <thread>
+#include <algorithm>
+
+// --backend=<iocp|epoll|io_uring> 인자로 I/O 백엔드 선택 (없으면 플랫폼 기본값)
+static bool ParseBackendArg(int argc, char* argv[], IOBackendType& type) {
+    const char* prefix = "--backend=";
+    type = IOBackend::DefaultType();
+
+    for (int i = 1; i < argc; ++i) {
+        if (strncmp(argv[i], prefix, strlen(prefix)) != 0) continue;
+
+        std::string name = argv[i] + strlen(prefix);
+        if (!IOBackend::ParseType(name, type)) {
+            std::cerr << "Unknown backend: " << name << " (iocp, epoll, io_uring)" << std::endl;
+            return false;
+        }
+    }
+    return true;
+}
+
+// --shards[=N] 인자로 샤드 모드 사용 (N 생략 시 CPU 수, 인자가 없으면 0 = 공유 워커 모드)
+static bool ParseShardArg(int argc, char* argv[], int& shardCount) {
+    const char* prefix = "--shards";
+    shardCount = 0;
+
+    for (int i = 1; i < argc; ++i) {
+        if (strncmp(argv[i], prefix, strlen(prefix)) != 0) continue;
+
+        const char* value = argv[i] + strlen(prefix);
+        if (*value == '\0') {
+            shardCount = static_cast<int>(std::max<unsigned>(1, std::thread::hardware_concurrency()));
+            continue;
+        }
+
+        shardCount = (*value == '=') ? atoi(value + 1) : 0;
+        if (shardCount <= 0) {
+            std::cerr << "Invalid shard count: " << argv[i] << " (--shards or --shards=N)" << std::endl;
+            return false;
+        }
+    }
+    return true;
+}
+
+// --slow-consumer=<collapse|drop|disconnect> 인자로 느린 수신자 정책 선택 (없으면 collapse)
+static bool ParseSlowConsumerArg(int argc, char* argv[]) {
+    const char* prefix = "--slow-consumer=";
+
+    for (int i = 1; i < argc; ++i) {
+        if (strncmp(argv[i], prefix, strlen(prefix)) != 0) continue;
+
+        std::string name = argv[i] + strlen(prefix);
+        SlowConsumerPolicy policy;
+        if (!Session::ParseSlowConsumerPolicy(name, policy)) {
+            std::cerr << "Unknown slow consumer policy: " << name << " (collapse, drop, disconnect)" << std::endl;
+            return false;
+        }
+        Session::SetSlowConsumerPolicy(policy);
+    }
+    return true;
+}
+
+// --recv-buffers=<on-demand|posted> 인자로 수신 버퍼 방식 선택 (없으면 on-demand)
+static bool ParseRecvBufferArg(int argc, char* argv[]) {
+    const char* prefix = "--recv-buffers=";
+
+    for (int i = 1; i < argc; ++i) {
+        if (strncmp(argv[i], prefix, strlen(prefix)) != 0) continue;
+
+        std::string name = argv[i] + strlen(prefix);
+        RecvBufferMode mode;
+        if (!Session::ParseRecvBufferMode(name, mode)) {
+            std::cerr << "Unknown recv buffer mode: " << name << " (on-demand, posted)" << std::endl;
+            return false;
+        }
+        Session::SetRecvBufferMode(mode);
+    }
+    return true;
+}
+
+// --rate-limit=<auth|chat|answer>=초당[/최대] 인자로 세션별 패킷 속도 제한 변경 (여러 번 지정 가능)
+// --rate-limit=off 는 모두 해제
+static bool ParseRateLimitArg(int argc, char* argv[]) {
+    const char* prefix = "--rate-limit=";
+
+    for (int i = 1; i < argc; ++i) {
+        if (strncmp(argv[i], prefix, strlen(prefix)) != 0) continue;
+
+        if (!Session::ParseRateLimit(argv[i] + strlen(prefix))) {
+            std::cerr << "Invalid rate limit: " << argv[i]
+                      << " (--rate-limit=<auth|chat|answer>=perSec[/burst] or --rate-limit=off)" << std::endl;
+            return false;
+        }
+    }
+    return true;
+}
+
+// --max-clients=N[/SOFT] 인자로 연결 수 상한 지정 (SOFT 이상이면 SERVER_BUSY, N 이상이면 바로 닫음)
+static bool ParseMaxClientsArg(int argc, char* argv[], int& hardLimit, int& softLimit) {
+    const char* prefix = "--max-clients=";
+    hardLimit = IOCPServer::MAX_CLIENTS;
+    softLimit = 0; // IOCPServer가 hardLimit 기준으로 계산
+
+    for (int i = 1; i < argc; ++i) {
+        if (strncmp(argv[i], prefix, strlen(prefix)) != 0) continue;
+
+        const char* value = argv[i] + strlen(prefix);
+        hardLimit = atoi(value);
+        const char* slash = strchr(value, '/');
+        softLimit = slash ? atoi(slash + 1) : 0;
+        if (hardLimit <= 0 || softLimit < 0 || softLimit > hardLimit) {
+            std::cerr << "Invalid client limit: " << argv[i] << " (--max-clients=N or --max-clients=N/SOFT)" << std::endl;
+            return false;
+        }
+    }
+    return true;
+}
+
+// --batch=N 인자로 워커가 한 번에 가져오는 완료 수 지정 (1이면 완료마다 대기, 없으면 최대값)
+static bool ParseBatchArg(int argc, char* argv[], int& batch) {
+    const char* prefix = "--batch=";
+    batch = IOBackend::MAX_COMPLETION_BATCH;
+
+    for (int i = 1; i < argc; ++i) {
+        if (strncmp(argv[i], prefix, strlen(prefix)) != 0) continue;
+
+        batch = atoi(argv[i] + strlen(prefix));
+        if (batch <= 0 || batch > IOBackend::MAX_COMPLETION_BATCH) {
+            std::cerr << "Invalid completion batch: " << argv[i] << " (1.."
+                      << IOBackend::MAX_COMPLETION_BATCH << ")" << std::endl;
+            return false;
+        }
+    }
+    return true;
+}
+
+// --busy-poll=US 인자로 저지연 모드 사용 (워커가 잠들기 전 US 마이크로초 동안 완료를 바쁜 대기, 없으면 0 = 끔)
+static bool ParseBusyPollArg(int argc, char* argv[], int& pollUs) {
+    const char* prefix = "--busy-poll=";
+    pollUs = 0;
+
+    for (int i = 1; i < argc; ++i) {
+        if (strncmp(argv[i], prefix, strlen(prefix)) != 0) continue;
+
+        pollUs = atoi(argv[i] + strlen(prefix));
+        if (pollUs < 0 || pollUs > 1000000) {
+            std::cerr << "Invalid busy poll time: " << argv[i] << " (--busy-poll=0..1000000 us)" << std::endl;
+            return false;
+        }
+    }
+    return true;
+}
+
+// --unix-socket=<경로> 인자로 같은 호스트의 게이트웨이/봇용 Unix 도메인 소켓 리스너 추가 (Linux)
+static bool ParseUnixSocketArg(int argc, char* argv[], std::string& path) {
+    const char* prefix = "--unix-socket=";
+    path.clear();
+
+    for (int i = 1; i < argc; ++i) {
+        if (strncmp(argv[i], prefix, strlen(prefix)) != 0) continue;
+
+        path = argv[i] + strlen(prefix);
+        if (path.empty()) {
+            std::cerr << "Invalid unix socket path: " << argv[i] << " (--unix-socket=<path>)" << std::endl;
+            return false;
+        }
+    }
+    return true;
+}
+
+// --session-pool=N 인자로 미리 만들어 둘 Session 수 지정 (0이면 연결마다 새로 할당)
+static bool ParseSessionPoolArg(int argc, char* argv[], int& poolSize) {
+    const char* prefix = "--session-pool=";
+    poolSize = IOCPServer::SESSION_POOL_SIZE;
+
+    for (int i = 1; i < argc; ++i) {
+        if (strncmp(argv[i], prefix, strlen(prefix)) != 0) continue;
+
+        poolSize = atoi(argv[i] + strlen(prefix));
+        if (poolSize < 0 || poolSize > IOCPServer::MAX_CLIENTS * 4) {
+            std::cerr << "Invalid session pool size: " << argv[i] << " (--session-pool=0.."
+                      << IOCPServer::MAX_CLIENTS * 4 << ")" << std::endl;
+            return false;
+        }
+    }
+    return true;
+}
+
+// --handoff=<unix 소켓 경로> 인자로 무중단 재시작 사용 (Linux)
+// 같은 경로로 실행 중인 서버가 있으면 리슨 소켓을 넘겨받고, 이전 서버는 진행 중인 게임을 마친 뒤 종료
+static bool ParseHandoffArg(int argc, char* argv[], std::string& path) {
+    const char* prefix = "--handoff=";
+    path.clear();
+
+    for (int i = 1; i < argc; ++i) {
+        if (strncmp(argv[i], prefix, strlen(prefix)) != 0) continue;
+
+        path = argv[i] + strlen(prefix);
+        if (path.empty()) {
+            std::cerr << "Invalid handoff socket path: " << argv[i] << " (--handoff=<path>)" << std::endl;
+            return false;
+        }
+    }
+    return true;
+}
+
+#ifdef _WIN32
 
 // 전역 서버 포인터와 종료 이벤트
 IOCPServer* g_server = nullptr;
@@ -26,22 +233,45 @@ BOOL WINAPI ConsoleHandler(DWORD dwCtrlType) {
     }
 }
 
-int main() {
+int main(int argc, char* argv[]) {
     std::cout << "CodeNames IOCP Server Starting..." << std::endl;
-    
+
+    IOBackendType backendType;
+    int shardCount;
+    int completionBatch;
+    int maxClients;
+    int softClients;
+    std::string handoffPath;
+    int busyPollUs;
+    std::string unixSocketPath;
+    int sessionPoolSize;
+    if (!ParseBackendArg(argc, argv, backendType) || !ParseShardArg(argc, argv, shardCount) ||
+        !ParseSlowConsumerArg(argc, argv) || !ParseRecvBufferArg(argc, argv) ||
+        !ParseRateLimitArg(argc, argv) || !ParseBatchArg(argc, argv, completionBatch) ||
+        !ParseMaxClientsArg(argc, argv, maxClients, softClients) || !ParseHandoffArg(argc, argv, handoffPath) ||
+        !ParseBusyPollArg(argc, argv, busyPollUs) || !ParseUnixSocketArg(argc, argv, unixSocketPath) ||
+        !ParseSessionPoolArg(argc, argv, sessionPoolSize)) {
+        return -1;
+    }
+
     // 종료 이벤트 생성
     g_shutdownEvent = CreateEvent(NULL, TRUE, FALSE, NULL);
     if (!g_shutdownEvent) {
         std::cerr << "Failed to create shutdown event" << std::endl;
         return -1;
     }
-    
+
     // Windows 콘솔 핸들러 등록
     SetConsoleCtrlHandler(ConsoleHandler, TRUE);
 
-    IOCPServer server;
+    IOCPServer server(IOCPServer::SERVER_PORT, backendType, shardCount, completionBatch);
+    server.SetConnectionLimits(maxClients, softClients);
+    server.SetBusyPoll(busyPollUs);
+    server.SetUnixSocketPath(unixSocketPath);
+    server.SetSessionPoolSize(sessionPoolSize);
+    server.SetHandoffPath(handoffPath); // Windows는 미지원 (인계 없이 새로 염)
     g_server = &server;
-    
+
     if (!server.Initialize()) {
         std::cerr << "Server initialization failed" << std::endl;
         system("pause");
@@ -52,12 +282,79 @@ int main() {
 
     server.Start();
     std::cout << "Server started! Press Ctrl+C to stop." << std::endl;
-    
+
     // 이벤트가 시그널될 때까지 블로킹
     WaitForSingleObject(g_shutdownEvent, INFINITE);
-    
+
     std::cout << "Server stopped." << std::endl;
     CloseHandle(g_shutdownEvent);
 
     return 0;
-}
\ No newline at end of file
+}
+
+#else
+
+#include <csignal>
+#include <pthread.h>
+
+int main(int argc, char* argv[]) {
+    std::cout << "CodeNames Server Starting..." << std::endl;
+
+    IOBackendType backendType;
+    int shardCount;
+    int completionBatch;
+    int maxClients;
+    int softClients;
+    std::string handoffPath;
+    int busyPollUs;
+    std::string unixSocketPath;
+    int sessionPoolSize;
+    if (!ParseBackendArg(argc, argv, backendType) || !ParseShardArg(argc, argv, shardCount) ||
+        !ParseSlowConsumerArg(argc, argv) || !ParseRecvBufferArg(argc, argv) ||
+        !ParseRateLimitArg(argc, argv) || !ParseBatchArg(argc, argv, completionBatch) ||
+        !ParseMaxClientsArg(argc, argv, maxClients, softClients) || !ParseHandoffArg(argc, argv, handoffPath) ||
+        !ParseBusyPollArg(argc, argv, busyPollUs) || !ParseUnixSocketArg(argc, argv, unixSocketPath) ||
+        !ParseSessionPoolArg(argc, argv, sessionPoolSize)) {
+        return -1;
+    }
+
+    // 워커 스레드 생성 전에 종료 시그널을 막아두고 메인 스레드에서 sigwait로 받음
+    sigset_t shutdownSignals;
+    sigemptyset(&shutdownSignals);
+    sigaddset(&shutdownSignals, SIGINT);
+    sigaddset(&shutdownSignals, SIGTERM);
+    pthread_sigmask(SIG_BLOCK, &shutdownSignals, nullptr);
+
+    // 끊어진 소켓에 send 시 프로세스가 종료되지 않도록
+    signal(SIGPIPE, SIG_IGN);
+
+    IOCPServer server(IOCPServer::SERVER_PORT, backendType, shardCount, completionBatch);
+    server.SetConnectionLimits(maxClients, softClients);
+    server.SetBusyPoll(busyPollUs);
+    server.SetUnixSocketPath(unixSocketPath);
+    server.SetSessionPoolSize(sessionPoolSize);
+    server.SetHandoffPath(handoffPath);
+    // 다음 프로세스에 리슨 소켓을 넘기고 게임이 모두 끝나면 종료 시그널과 같은 경로로 정리
+    server.SetDrainedHandler([]() { kill(getpid(), SIGTERM); });
+
+    if (!server.Initialize()) {
+        std::cerr << "Server initialization failed" << std::endl;
+        return -1;
+    }
+    std::cout << "Server initialized on port " << IOCPServer::SERVER_PORT << std::endl;
+
+    server.Start();
+    std::cout << "Server started! Press Ctrl+C to stop." << std::endl;
+
+    // 시그널이 올 때까지 블로킹
+    int signalNumber = 0;
+    sigwait(&shutdownSignals, &signalNumber);
+
+    std::cout << "\nServer shutting down..." << std::endl;
+    server.Stop();
+
+    std::cout << "Server stopped." << std::endl;
+    return 0;
+}
+
+#endif